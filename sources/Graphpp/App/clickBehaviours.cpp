@@ -17,6 +17,7 @@ void QBoard::clickCreateVertex(QPointF clickPos)
 {
     this->qCaretaker->backup();
     QString vertexName = "Vertex " + QString::number(this->graph->adjacencyList.size()+1); //start at 0
+    QMutexLocker locker(&this->sharedGraph->mutex);
     this->graph->addVertex(new QVertex(vertexName, clickPos));
 }
 
@@ -84,6 +85,7 @@ void QBoard::clickCreateEdge(QPointF clickPos)
         {
             this->qCaretaker->backup();
             // create edge
+            QMutexLocker locker(&this->sharedGraph->mutex);
             this->graph->addDoubleEdge(firstVertex, secondVertex);
             this->unselectVertices();
         }
@@ -130,6 +132,7 @@ void QBoard::clickCycleGraph(QPointF clickPos)
 
         this->qCaretaker->backup();
 
+        QMutexLocker locker(&this->sharedGraph->mutex);
         QVertex* arrayVertices[nbVertices];
         createRoundedVertices(arrayVertices, nbVertices, radius, clickPos);
 
@@ -151,9 +154,9 @@ void QBoard::clickCompleteGraph(QPointF clickPos)
 {
     // BUILDING MODAL
     // number of vertices
-    QLabel* nbVerticesLabel = new QLabel(tr("Choisissez le nombre de sommet (3-30):"),this);
+    QLabel* nbVerticesLabel = new QLabel(tr("Choisissez le nombre de sommet (3-100):"),this);
     QSpinBox* nbVerticesSpin = new QSpinBox(this);
-    nbVerticesSpin->setRange(3,30);
+    nbVerticesSpin->setRange(3,100);
     nbVerticesSpin->setValue(3);
     nbVerticesSpin->setSingleStep(1);
 
@@ -180,20 +183,24 @@ void QBoard::clickCompleteGraph(QPointF clickPos)
 
         this->qCaretaker->backup();
 
+        QMutexLocker locker(&this->sharedGraph->mutex);
         QVertex* arrayVertices[nbVertices];
         createRoundedVertices(arrayVertices, nbVertices, radius, clickPos);
 
-        // add edges to the graph
+        // add edges to the graph, all at once
+        std::vector<std::pair<QVertex*, QVertex*>> edges;
+        edges.reserve(nbVertices * (nbVertices - 1));
         for (auto * vertexSource: arrayVertices)
         {
             for (auto * vertexTarget: arrayVertices)
             {
                 if (vertexSource != vertexTarget)
                 {
-                    this->graph->addEdge(vertexSource, vertexTarget);
+                    edges.push_back(std::make_pair(vertexSource, vertexTarget));
                 }
             }
         }
+        this->graph->addEdges(edges);
     }
     this->update();
 }
@@ -273,6 +280,7 @@ void QBoard::clickBipartiteGraph(QPointF clickPos)
         int width = output.at(2);
         int height = output.at(3);
 
+        QMutexLocker locker(&this->sharedGraph->mutex);
         QVertex* arrayVertices1[nbVertices1];
         QVertex* arrayVertices2[nbVertices2];
 
@@ -281,17 +289,21 @@ void QBoard::clickBipartiteGraph(QPointF clickPos)
 
         this->qCaretaker->backup();
 
-        // add edges to the graph
+        // add edges to the graph, all at once
+        std::vector<std::pair<QVertex*, QVertex*>> edges;
+        edges.reserve(2 * nbVertices1 * nbVertices2);
         for (auto * vertexSource: arrayVertices1)
         {
             for (auto * vertexTarget: arrayVertices2)
             {
                 if (vertexSource != vertexTarget)
                 {
-                    this->graph->addDoubleEdge(vertexSource, vertexTarget);
+                    edges.push_back(std::make_pair(vertexSource, vertexTarget));
+                    edges.push_back(std::make_pair(vertexTarget, vertexSource));
                 }
             }
         }
+        this->graph->addEdges(edges);
 
     }
     this->update();
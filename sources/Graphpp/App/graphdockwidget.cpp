@@ -1,5 +1,6 @@
 #include "graphdockwidget.h"
 #include <QtWidgets>
+#include <QtConcurrent>
 
 /// @brief Constructor of the dock widget about graph analysis
 /// @param QWidget: parent
@@ -17,6 +18,9 @@ GraphDockWidget::GraphDockWidget(QWidget *parent) : QWidget(parent)
     chromaticNumber->setToolTip(tr("La méthode utilisée nous permet approcher la solution avec une complexité de O(n). Pour une solution exacte, il faudrait utiliser un 'brute force'"));
     nbEdges = new QLabel(tr("Nombre d'arrêtes: "), propertyPanel);
     nbVertices = new QLabel(tr("Nombre sommets: "), propertyPanel);
+    memoryUsage = new QLabel(tr("Mémoire: "), propertyPanel);
+    memoryUsage->setToolTip(tr("Mémoire utilisée par la structure du graphe, sans les sommets eux-mêmes"));
+    memoryUsage->setTextInteractionFlags(Qt::TextSelectableByMouse);
 
     QVBoxLayout *layout = new QVBoxLayout(propertyPanel);
     layout->setAlignment(Qt::AlignTop);
@@ -28,11 +32,15 @@ GraphDockWidget::GraphDockWidget(QWidget *parent) : QWidget(parent)
     layout->addWidget(chromaticNumber);
     layout->addWidget(nbEdges);
     layout->addWidget(nbVertices);
+    layout->addWidget(memoryUsage);
     layout->addStretch(1);
 
-    QPushButton *analyseBtn = new QPushButton(tr("Analyser"), propertyPanel);
+    analyseBtn = new QPushButton(tr("Analyser"), propertyPanel);
     connect(analyseBtn, &QPushButton::clicked, this, &GraphDockWidget::updateLabels);
 
+    analysisWatcher = new QFutureWatcher<GraphAnalysis>(this);
+    connect(analysisWatcher, &QFutureWatcher<GraphAnalysis>::finished, this, &GraphDockWidget::showAnalysis);
+
     QHBoxLayout *btnLayout = new QHBoxLayout(propertyPanel);
     btnLayout->setAlignment(Qt::AlignRight);
     btnLayout->addWidget(analyseBtn);
@@ -42,35 +50,84 @@ GraphDockWidget::GraphDockWidget(QWidget *parent) : QWidget(parent)
 }
 
 /// @brief updateLabels depending of the selected graph
+///
+/// The analysis runs in a background thread on a snapshot of the graph, so the board can still be edited meanwhile.
+/// The snapshot copies every edge, so it is taken by the background thread too, the board waiting for the copy
+/// if it is modified at the same time. The labels are updated by showAnalysis() when it is done.
 /// @author Plumey Simon
 void GraphDockWidget::updateLabels()
 {
-    if (this->selectedGraph != nullptr)
+    if (this->selectedGraph != nullptr && this->selectedGraph->graph != nullptr && !this->analysisWatcher->isRunning())
     {
-        eulerian->setText(tr("Eulérien: ") + (selectedGraph->isEulerian() ? tr("Oui") : tr("Non")));
-        qDebug() << "Eulerian done" << Qt::endl;
-        connected->setText(tr("Connexe: ") + (selectedGraph->isConnected() ? tr("Oui") : tr("Non")));
-        qDebug() << "Connexe done" << Qt::endl;
-        stronglyConnected->setText(tr("Fortement connexe: ") + (selectedGraph->isStronglyConnected() ? tr("Oui") : tr("Non")));
-        qDebug() << "Fortement connexe done" << Qt::endl;
-        oriented->setText(tr("Orienté: ") + (selectedGraph->isOriented() ? tr("Oui") : tr("Non")));
-        qDebug() << "Orienté done" << Qt::endl;
-        weighted->setText(tr("Pondéré: ") + (selectedGraph->isWeighted() ? tr("Oui") : tr("Non")));
-        qDebug() << "Pondéré done" << Qt::endl;
-        chromaticNumber->setText(tr("Estimation du nombre chromatique: ") + QString::number(selectedGraph->getChromaticNumber()));
-        qDebug() << "Estimation du nombre chromatique done" << Qt::endl;
-        nbEdges->setText(tr("Nombre d'arrêtes: ") + QString::number(selectedGraph->getNbEdges()));
-        qDebug() << "Nombre d'arrêtes done" << Qt::endl;
-        nbVertices->setText(tr("Nombre de sommets: ") + QString::number(selectedGraph->getNbVertices()));
-        qDebug() << "Nombre de sommets done" << Qt::endl;
+        std::shared_ptr<SharedGraph> sharedGraph = this->selectedGraph;
+        analyseBtn->setEnabled(false);
+        analysisWatcher->setFuture(QtConcurrent::run([sharedGraph]()
+        {
+            GraphAnalysis analysis;
+            std::shared_ptr<Graph<QVertex>> snapshot;
+            {
+                // The board may have been closed before the thread started
+                QMutexLocker locker(&sharedGraph->mutex);
+                if (sharedGraph->graph == nullptr)
+                {
+                    return analysis;
+                }
+                snapshot = sharedGraph->graph->snapshot();
+            }
+            analysis.eulerian = snapshot->getEulerianKind();
+            qDebug() << "Eulerian done" << Qt::endl;
+            analysis.connected = snapshot->isConnected();
+            qDebug() << "Connexe done" << Qt::endl;
+            analysis.stronglyConnected = snapshot->isStronglyConnected();
+            qDebug() << "Fortement connexe done" << Qt::endl;
+            analysis.oriented = snapshot->isOriented();
+            qDebug() << "Orienté done" << Qt::endl;
+            analysis.weighted = snapshot->isWeighted();
+            qDebug() << "Pondéré done" << Qt::endl;
+            analysis.chromaticNumber = snapshot->getChromaticNumber();
+            qDebug() << "Estimation du nombre chromatique done" << Qt::endl;
+            analysis.nbEdges = snapshot->getNbEdges();
+            analysis.nbVertices = snapshot->getNbVertices();
+            return analysis;
+        }));
 
+        // Debug view of the memory footprint, by category
+        MemoryUsage usage = selectedGraph->graph->memoryUsage();
+        QLocale locale;
+        auto formatSize = [&locale](size_t bytes) { return locale.formattedDataSize(static_cast<qint64>(bytes)); };
+        memoryUsage->setText(tr("Mémoire: ") + formatSize(usage.getTotal())
+                             + "\n    " + tr("Table des sommets: ") + formatSize(usage.vertexTable)
+                             + "\n    " + tr("Listes d'adjacence: ") + formatSize(usage.adjacency)
+                             + "\n    " + tr("Arcs: ") + formatSize(usage.edges)
+                             + "\n    " + tr("Index des arcs entrants: ") + formatSize(usage.incomingIndex)
+                             + "\n    " + tr("Index des arcs: ") + formatSize(usage.edgeIndex)
+                             + "\n    " + tr("Cache: ") + formatSize(usage.cache));
     }
 }
 
+/// @brief Displays the results of the background analysis
+/// @author The Graph++ Development Team
+void GraphDockWidget::showAnalysis()
+{
+    GraphAnalysis analysis = analysisWatcher->result();
+    QString eulerianText = analysis.eulerian == EulerianKind::Circuit ? tr("Oui")
+                         : analysis.eulerian == EulerianKind::Path ? tr("Chemin seulement")
+                                                                     : tr("Non");
+    eulerian->setText(tr("Eulérien: ") + eulerianText);
+    connected->setText(tr("Connexe: ") + (analysis.connected ? tr("Oui") : tr("Non")));
+    stronglyConnected->setText(tr("Fortement connexe: ") + (analysis.stronglyConnected ? tr("Oui") : tr("Non")));
+    oriented->setText(tr("Orienté: ") + (analysis.oriented ? tr("Oui") : tr("Non")));
+    weighted->setText(tr("Pondéré: ") + (analysis.weighted ? tr("Oui") : tr("Non")));
+    chromaticNumber->setText(tr("Estimation du nombre chromatique: ") + QString::number(analysis.chromaticNumber));
+    nbEdges->setText(tr("Nombre d'arrêtes: ") + QString::number(analysis.nbEdges));
+    nbVertices->setText(tr("Nombre de sommets: ") + QString::number(analysis.nbVertices));
+    analyseBtn->setEnabled(true);
+}
+
 /// @brief Set the selected graph
-/// @param Graph<QVertex>*: graph of QVertex
+/// @param std::shared_ptr<SharedGraph>: graph of QVertex, shared with its board
 /// @author Plumey Simon
-void GraphDockWidget::setSelectedGraph(Graph<QVertex>* graph)
+void GraphDockWidget::setSelectedGraph(std::shared_ptr<SharedGraph> graph)
 {
     this->selectedGraph = graph;
 }
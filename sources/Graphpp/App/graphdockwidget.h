@@ -2,24 +2,57 @@
 #define GRAPHDOCKWIDGET_H
 
 #include <QtWidgets>
+#include <QFutureWatcher>
+#include <QMutex>
+#include <memory>
 #include "graph.h"
 
 class QVertex;
 
+/// @brief Results of the analysis of a graph, computed by a background thread
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+struct GraphAnalysis
+{
+    EulerianKind eulerian = EulerianKind::None;
+    bool connected = false;
+    bool stronglyConnected = false;
+    bool oriented = false;
+    bool weighted = false;
+    int chromaticNumber = 0;
+    int nbEdges = 0;
+    int nbVertices = 0;
+};
+
+/// @brief The graph of a board, shared with the background analyses which copy it
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The board holds the mutex while it modifies or replaces the graph, and an analysis while it takes its snapshot,
+/// so that the copy runs off the GUI thread. The graph is nullptr once the board is closed.
+struct SharedGraph
+{
+    QMutex mutex;
+    Graph<QVertex> *graph = nullptr;
+};
+
 /// @brief QWidget displaying all informations about graph analysis. Like eulerian, oriented,...
 /// @author Plumey Simon
 /// @date spring 2023
 class GraphDockWidget : public QWidget
 {
 private:
-    Graph<QVertex>* selectedGraph = nullptr;
+    std::shared_ptr<SharedGraph> selectedGraph;
 
     QLabel *eulerian, *hamiltonian, *connected, *stronglyConnected, *oriented,
-    *weighted, *chromaticNumber, *nbEdges, *nbVertices;
+    *weighted, *chromaticNumber, *nbEdges, *nbVertices, *memoryUsage;
+    QPushButton *analyseBtn;
+    QFutureWatcher<GraphAnalysis> *analysisWatcher;
     void updateLabels();
+    void showAnalysis();
 
 public:
-    void setSelectedGraph(Graph<QVertex> *graph);
+    void setSelectedGraph(std::shared_ptr<SharedGraph> graph);
     GraphDockWidget(QWidget *parent);
 };
 
@@ -86,6 +86,10 @@ void MainWindow::createActions()
     highlightHamPathAct->setStatusTip(tr("Indique l'un des chemins hamiltoniens possibles"));
     connect(highlightHamPathAct, &QAction::triggered, this, &MainWindow::highlightHamiltonianPath);
 
+    highlightEulerPathAct = new QAction(tr("Afficher un chemin eulérien"), this);
+    highlightEulerPathAct->setStatusTip(tr("Indique un cycle eulérien, ou à défaut un chemin eulérien"));
+    connect(highlightEulerPathAct, &QAction::triggered, this, &MainWindow::highlightEulerianPath);
+
     // TOOLS actions
     selectToolAct = new QAction(QIcon(":/img/selector.png"), tr("&Outil de sélection"), this);
     selectToolAct->setShortcut(tr("Ctrl+1"));
@@ -202,6 +206,7 @@ void MainWindow::createMenus()
     algorithmMenu->addAction(highlightMDGAct);
     algorithmMenu->addAction(highlightMSTAct);
     algorithmMenu->addAction(highlightHamPathAct);
+    algorithmMenu->addAction(highlightEulerPathAct);
 }
 
 /// @brief Create the tool bars
@@ -395,6 +400,18 @@ void MainWindow::highlightHamiltonianPath()
     }
 }
 
+/// @brief Computes an eulerian circuit or path and highlights it.
+/// @author The Graph++ Development Team
+void MainWindow::highlightEulerianPath()
+{
+    QMdiSubWindow* qMDISubWindow = this->mdi->activeSubWindow();
+    if (qMDISubWindow != nullptr)
+    {
+        QBoard* qBoard = (QBoard*)(qMDISubWindow->widget());
+        qBoard->highlightEulerianPath();
+    }
+}
+
 /// @brief Used to change settings depending of the current active sub window and
 /// changing graph settings like selected tool, current graph dock widget,
 /// vertex dock widget,...
@@ -407,7 +424,7 @@ void MainWindow::initialiseGraphSettings()
     {
         // change graph and vertex docks widget
         QBoard* qBoard = (QBoard*)(qMDISubWindow->widget());
-        graphDockWidget->setSelectedGraph(qBoard->graph);
+        graphDockWidget->setSelectedGraph(qBoard->sharedGraph);
         vertexDockWidget->setSelectedGraph(qBoard->graph);
 
         // for undo-redo buttons
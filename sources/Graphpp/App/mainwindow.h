@@ -26,7 +26,8 @@ private:
     *newVertexAct, *linkVertexAct, *eraserAct, *moveToolAct,
     *cycleGrapheAct, *completeGrapheAct, *bipartiteGrapheAct,
     *closeCurrentGrapheAct, *closeAllGrapheAct, *nextAct, *prevAct,
-    *toggleGraphDockAct, *toggleVertexDockAct, *highlightMDGAct, *highlightMSTAct, *highlightHamPathAct;
+    *toggleGraphDockAct, *toggleVertexDockAct, *highlightMDGAct, *highlightMSTAct, *highlightHamPathAct,
+    *highlightEulerPathAct;
     QDockWidget *vertexDock, *graphDock;
     QMdiArea *mdi;
     QActionGroup *toolsActGroup;
@@ -48,6 +49,7 @@ private slots:
     void highlightMinimumDistanceGraph();
     void highlightMinimumSpanningTree();
     void highlightHamiltonianPath();
+    void highlightEulerianPath();
 
     void initialiseGraphSettings();
     void updateSelectedTool(QAction* action);
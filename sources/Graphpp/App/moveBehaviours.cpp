@@ -17,9 +17,10 @@ void QBoard::moveEraser(QPointF clickPos)
     {
         this->qCaretaker->backup();
         qDebug() << "Before pop" << Qt::endl;
+        QMutexLocker locker(&this->sharedGraph->mutex);
         graph->popVertex(hittedVertex);
         qDebug() << "After pop" << Qt::endl;
-        this->highlightedGraph = nullptr;
+        this->highlightedEdges.clear();
     }
 
     // check if hit edge
@@ -40,12 +41,13 @@ void QBoard::moveEraser(QPointF clickPos)
             }
         }
         // remove edges
-        for (auto * edge : edgesToRemove)
+        if (!edgesToRemove.empty())
         {
             this->qCaretaker->backup();
-            graph->popEdge(edge);
+            QMutexLocker locker(&this->sharedGraph->mutex);
+            graph->popEdges(edgesToRemove);
         }
-        this->highlightedGraph = nullptr;
+        this->highlightedEdges.clear();
     }
 }
 
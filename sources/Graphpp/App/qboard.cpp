@@ -11,7 +11,10 @@ QBoard::QBoard(VertexDockWidget *vertexDockWidget, QWidget *parent)
     : QWidget(parent)
 {
     this->graph = new Graph<QVertex>();
-    this->highlightedGraph = new Graph<QVertex>();
+    this->graph->setIncomingEdgeIndex(true); // the eraser removes vertices on every mouse move
+    this->graph->setEdgeIndex(true);         // the generators add many edges, each checked for duplicates
+    this->sharedGraph = std::make_shared<SharedGraph>();
+    this->sharedGraph->graph = this->graph;
     this->vertexDockWidget = vertexDockWidget;
     connect(vertexDockWidget, &VertexDockWidget::vertexUpdated, this, qOverload<>(&QWidget::update));
 
@@ -23,8 +26,12 @@ QBoard::QBoard(VertexDockWidget *vertexDockWidget, QWidget *parent)
 /// @author Plumey Simon
 QBoard::~QBoard()
 {
+    {
+        // A background analysis may be copying the graph
+        QMutexLocker locker(&this->sharedGraph->mutex);
+        this->sharedGraph->graph = nullptr;
+    }
     delete this->graph;
-    delete this->highlightedGraph;
 }
 
 /// @brief Paint event method. Called on every graph update.
@@ -75,20 +82,13 @@ void QBoard::paint(QPainter &painter)
         }
 
         // Redraw highlighted edges if needed
-        if (this->highlightedGraph != nullptr)
+        painter.setBrush(Qt::red);
+        for (auto *edge : this->highlightedEdges)
         {
-            painter.setBrush(Qt::red);
-            for (auto &mapRow : this->highlightedGraph->adjacencyList)
-            {
-                QPointF sourceVertexPos = mapRow.first->getPosition().toPoint();
-                for (auto &edge : mapRow.second)
-                {
-                    painter.setPen(QPen(Qt::red, log(edge->getWeight()) + 1, Qt::SolidLine, Qt::RoundCap));
-                    QVertex *targetVertex = edge->getTarget();
-                    QPointF targetVertexPos = targetVertex->getPosition().toPoint();
-                    painter.drawLine(sourceVertexPos, targetVertexPos);
-                }
-            }
+            painter.setPen(QPen(Qt::red, log(edge->getWeight()) + 1, Qt::SolidLine, Qt::RoundCap));
+            QPointF sourceVertexPos = edge->getSource()->getPosition().toPoint();
+            QPointF targetVertexPos = edge->getTarget()->getPosition().toPoint();
+            painter.drawLine(sourceVertexPos, targetVertexPos);
         }
 
         // Display vertices
@@ -139,7 +139,10 @@ QMemento QBoard::save()
 /// @author Plumey Simon
 void QBoard::restore(QMemento memento)
 {
-    this->graph->adjacencyList = memento.getAdjencyList();
+    QMutexLocker locker(&this->sharedGraph->mutex);
+    this->graph->adjacencyList = memento.takeAdjacencyList();
+    this->graph->rebuildIndexes();
+    this->highlightedEdges.clear(); // they may not belong to the restored graph
 }
 
 /// @brief Return the caretaker
@@ -188,7 +191,7 @@ void QBoard::saveToFile(QString path)
     if (file.open(QIODevice::ReadWrite))
     {
         QJsonObject json;
-        for (auto pair : this->graph->adjacencyList)
+        for (auto const &pair : this->graph->adjacencyList)
         {
             // Get the vertex address as a string
             std::ostringstream address;
@@ -242,9 +245,16 @@ void QBoard::openFile(QString path)
         QJsonDocument doc = QJsonDocument::fromJson(data.toUtf8());
 
         std::unordered_map<QString, QVertex *> vertices;
+        std::vector<QVertex *> newVertices;
+        std::vector<std::tuple<QVertex *, QVertex *, int>> newEdges;
         if (!doc.isNull())
         {
+            QMutexLocker locker(&this->sharedGraph->mutex);
             this->graph = new Graph<QVertex>();
+            this->sharedGraph->graph = this->graph;
+            this->graph->setIncomingEdgeIndex(true);
+            this->graph->setEdgeIndex(true);
+            this->highlightedEdges.clear();
             QJsonObject obj = doc.object();
 
             QJsonObject::const_iterator it = obj.constBegin();
@@ -264,10 +274,11 @@ void QBoard::openFile(QString path)
                     QColor borderColor = QColor(vertexJson["borderColor"].toString("#000000"));
                     QVertex *vertex = new QVertex(name, position, textColor, backgroundColor, borderColor);
                     vertices.insert(std::make_pair(id, vertex));
-                    this->graph->addVertex(vertex);
+                    newVertices.push_back(vertex);
                 }
                 it++;
             } while (it != end);
+            this->graph->addVertices(newVertices);
 
             // Add all edges next
             it = obj.constBegin();
@@ -286,12 +297,13 @@ void QBoard::openFile(QString path)
                             QVertex *source = vertices[id];
                             QVertex *target = vertices[edgeJson["target"].toString()];
                             int weight = edgeJson["weight"].toInt(1);
-                            this->graph->addEdge(source, target, weight);
+                            newEdges.push_back(std::make_tuple(source, target, weight));
                         }
                     }
                 }
                 it++;
             } while (it != end);
+            this->graph->addEdges(newEdges);
         }
     }
 }
@@ -413,9 +425,14 @@ void QBoard::askEdgeNewWeight(QVertex* source, Edge<QVertex>* edge){
                 edge->getWeight(),
                 1
                 );
-            edge->setWeight(newWeight);
+            QMutexLocker locker(&this->sharedGraph->mutex);
+            this->graph->setEdgeWeight(edge, newWeight);
+            if(edge->getTwin() != nullptr) {
+                this->graph->setEdgeWeight(edge->getTwin(), newWeight);
+            }
         } else if(this->selectedEdge->getTarget() == source) {
-            edge->setWeight(this->selectedEdge->getWeight());
+            QMutexLocker locker(&this->sharedGraph->mutex);
+            this->graph->setEdgeWeight(edge, this->selectedEdge->getWeight());
             this->selectedEdge = nullptr;
         }
     } else {
@@ -429,7 +446,8 @@ void QBoard::askEdgeNewWeight(QVertex* source, Edge<QVertex>* edge){
             edge->getWeight(),
             1
             );
-        edge->setWeight(newWeight);
+        QMutexLocker locker(&this->sharedGraph->mutex);
+        this->graph->setEdgeWeight(edge, newWeight);
     }
     this->update();
 }
@@ -527,7 +545,7 @@ void QBoard::wheelEvent(QWheelEvent *event)
     {
         if (mapRow.first->isSelected())
         {
-            highlightedGraph = graph->getMinimumDistanceGraph(mapRow.first);
+            highlightedEdges = graph->getShortestPaths(mapRow.first).getTreeEdges();
         }
     }
 
@@ -564,7 +582,7 @@ void QBoard::highlightMinimumDistanceGraph()
     {
         if (mapRow.first->isSelected())
         {
-            this->highlightedGraph = graph->getMinimumDistanceGraph(mapRow.first);
+            this->highlightedEdges = graph->getShortestPaths(mapRow.first).getTreeEdges();
             this->update();
             return;
         }
@@ -579,13 +597,44 @@ void QBoard::highlightMinimumDistanceGraph()
 /// @author Flückiger Jonas
 void QBoard::highlightMinimumSpanningTree()
 {
-    this->highlightedGraph = graph->getMinimumSpanningTree();
+    this->highlightedEdges = graph->getMinimumSpanningTreeEdges();
     this->update();
 }
 
-/// @brief Highlights the current graph's hamiltonian path.
+/// @brief Highlights the current graph's hamiltonian circuit, or else a hamiltonian path.
 /// @author Tschan Damien
+///
+/// Each search of a large graph gives up after a few seconds, so that the application does not freeze.
 void QBoard::highlightHamiltonianPath(){
-    this->highlightedGraph = graph->getHamiltonianPath();
+    const std::chrono::milliseconds timeLimit(3000);
+    HamiltonianStatus status;
+    this->highlightedEdges = graph->getHamiltonianPathEdges(true, timeLimit, nullptr, &status);
+    if (status == HamiltonianStatus::None)
+    {
+        this->highlightedEdges = graph->getHamiltonianPathEdges(false, timeLimit, nullptr, &status);
+    }
+    if (status != HamiltonianStatus::Found)
+    {
+        QMessageBox msgBox;
+        msgBox.setText(status == HamiltonianStatus::None ? tr("Le graphe n'a ni cycle ni chemin hamiltonien")
+                                                         : tr("La recherche d'un chemin hamiltonien a pris trop de temps et a été interrompue"));
+        msgBox.setDefaultButton(QMessageBox::Ok);
+        msgBox.exec();
+    }
+    this->update();
+}
+
+/// @brief Highlights an eulerian circuit of the current graph, or else an eulerian path.
+/// @author The Graph++ Development Team
+void QBoard::highlightEulerianPath()
+{
+    this->highlightedEdges = graph->getEulerianPath();
+    if (graph->getEulerianKind() == EulerianKind::None)
+    {
+        QMessageBox msgBox;
+        msgBox.setText(tr("Le graphe n'a ni cycle ni chemin eulérien"));
+        msgBox.setDefaultButton(QMessageBox::Ok);
+        msgBox.exec();
+    }
     this->update();
 }
@@ -5,6 +5,7 @@
 #include <QtWidgets>
 #include "qvertex.h"
 #include "vertexdockwidget.h"
+#include "graphdockwidget.h"
 #include <graph.h>
 #include "qmemento.h"
 
@@ -38,8 +39,12 @@ public:
     void highlightMinimumDistanceGraph();
     void highlightMinimumSpanningTree();
     void highlightHamiltonianPath();
+    void highlightEulerianPath();
     Graph<QVertex> *graph;
-    Graph<QVertex>* highlightedGraph;
+    /// @brief The graph as shared with the background analyses, whose mutex is held while the graph is modified
+    std::shared_ptr<SharedGraph> sharedGraph;
+    /// @brief The edges highlighted in red, the result of the last analysis
+    std::vector<Edge<QVertex>*> highlightedEdges;
 
     // methods for undo/redo function
     QMemento save();
@@ -24,8 +24,6 @@ public:
     void redo();
     bool canUndo();
     bool canRedo();
-    void deleteDifferences(std::unordered_map<QVertex*, std::list<Edge<QVertex>*>> graphMap,
-                           std::unordered_map<QVertex*, std::list<Edge<QVertex>*>> mementoMap);
 
 signals:
     void backupAction();
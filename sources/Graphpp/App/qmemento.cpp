@@ -8,15 +8,23 @@ QMemento::QMemento(){}
 
 /// @brief Constructor of QMemento
 /// @author Plumey Simon
-QMemento::QMemento(std::unordered_map<QVertex *, std::list<Edge<QVertex> *>> adjencyList)
+QMemento::QMemento(Graph<QVertex>::AdjacencyMap adjencyList)
 {
-    this->adjacencyList = adjencyList;
+    this->adjacencyList = std::move(adjencyList);
 }
 
 /// @brief Getter of attribut adjencyList
-/// @return std::unordered_map<QVertex *, std::list<Edge<QVertex> *>>
+/// @return Graph<QVertex>::AdjacencyMap
 /// @author Plumey Simon
-std::unordered_map<QVertex *, std::list<Edge<QVertex> *>> QMemento::getAdjencyList()
+Graph<QVertex>::AdjacencyMap QMemento::getAdjencyList()
 {
     return this->adjacencyList;
 }
+
+/// @brief Moves the adjacency list out of the memento, which is left empty
+/// @return Graph<QVertex>::AdjacencyMap
+/// @author The Graph++ Development Team
+Graph<QVertex>::AdjacencyMap QMemento::takeAdjacencyList()
+{
+    return std::move(this->adjacencyList);
+}
@@ -1,9 +1,8 @@
 #ifndef QMEMENTO_H
 #define QMEMENTO_H
 #include <unordered_map>
-#include <list>
+#include <graph.h>
 #include "qvertex.h"
-#include <edge.h>
 
 /// @brief Memento of qboard state. It's part of the memento design pattern
 /// @author Plumey Simon
@@ -12,11 +11,12 @@ class QMemento
 {
 public:
     QMemento(); // Default constructor for use in data structs
-    QMemento(std::unordered_map<QVertex *, std::list<Edge<QVertex> *>> adjencyList);
-    std::unordered_map<QVertex *, std::list<Edge<QVertex> *>> getAdjencyList();
+    QMemento(Graph<QVertex>::AdjacencyMap adjencyList);
+    Graph<QVertex>::AdjacencyMap getAdjencyList();
+    Graph<QVertex>::AdjacencyMap takeAdjacencyList();
 
 private:
-    std::unordered_map<QVertex *, std::list<Edge<QVertex> *>> adjacencyList;
+    Graph<QVertex>::AdjacencyMap adjacencyList;
 
 };
 
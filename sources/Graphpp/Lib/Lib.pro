@@ -3,7 +3,7 @@ CONFIG -= qt
 TEMPLATE = lib
 DEFINES += LIB_LIBRARY
 
-CONFIG += c++17
+CONFIG += c++17 thread
 
 # You can make your code fail to compile if it uses deprecated APIs.
 # In order to do so, uncomment the following line.
@@ -14,9 +14,25 @@ SOURCES += \
     graph.cpp
 
 HEADERS += \
+    adjacency_list.h \
+    breadth_first_search.h \
+    compact_graph.h \
+    compressed_adjacency.h \
+    connected_components.h \
+    csr_view.h \
+    direction.h \
     edge.h \
+    edge_allocator.h \
     graph.h \
-    queue_element.h
+    hamiltonian_search.h \
+    held_karp.h \
+    mapped_csr_graph.h \
+    memory_usage.h \
+    queue_element.h \
+    shortest_paths.h \
+    snapshot_epoch.h \
+    thread_pool.h \
+    vertex_order.h
 
 # Default rules for deployment.
 unix {
@@ -0,0 +1,294 @@
+#ifndef ADJACENCY_LIST_H
+#define ADJACENCY_LIST_H
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+/// @brief Contiguous container of the outgoing edges of a vertex
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// A small vector of edge pointers : the first N edges are stored inline, in the container itself,
+/// and the storage moves to the heap only for vertices of higher degree. Neighbour iteration is thus a linear scan
+/// over contiguous pointers instead of a walk over list nodes.
+///
+/// It offers the subset of the std::list interface used by the library and the application
+/// (iteration, size, front/back, push_back, erase, remove, clear), with one difference :
+/// erasing swaps the last edge into the erased position, so the order of the edges is not preserved.
+/// erase(it) returns `it`, which then refers to the swapped-in edge, so the `it = list.erase(it)` loops keep working.
+template <typename E, unsigned N = 4> class AdjacencyList
+{
+public:
+    typedef E *value_type;
+    typedef E *&reference;
+    typedef E *const &const_reference;
+    typedef E **iterator;
+    typedef E *const *const_iterator;
+    typedef uint32_t size_type;
+
+    AdjacencyList();
+    AdjacencyList(const AdjacencyList &other);
+    AdjacencyList(AdjacencyList &&other) noexcept;
+    AdjacencyList &operator=(const AdjacencyList &other);
+    AdjacencyList &operator=(AdjacencyList &&other) noexcept;
+    ~AdjacencyList();
+
+    // -- iteration --
+    iterator begin() { return this->data; }
+    iterator end() { return this->data + this->count; }
+    const_iterator begin() const { return this->data; }
+    const_iterator end() const { return this->data + this->count; }
+
+    // -- accessors --
+    size_type size() const { return this->count; }
+    size_type capacity() const { return this->maximum; }
+    bool empty() const { return this->count == 0; }
+    /// @brief Returns the bytes allocated on the heap, the inline storage being part of the list itself
+    size_t memoryUsage() const { return this->isInline() ? 0 : this->maximum * sizeof(E *); }
+    reference front() { return this->data[0]; }
+    reference back() { return this->data[this->count - 1]; }
+    const_reference front() const { return this->data[0]; }
+    const_reference back() const { return this->data[this->count - 1]; }
+    reference operator[](size_type index) { return this->data[index]; }
+    const_reference operator[](size_type index) const { return this->data[index]; }
+
+    // -- modifiers --
+    void push_back(E *edge);
+    void pop_back();
+    iterator erase(iterator position);
+    void remove(E *edge);
+    void clear();
+    void reserve(size_type capacity);
+    void shrink_to_fit();
+
+private:
+    /// @brief The current storage, either inlineEdges or a heap array
+    E **data;
+    /// @brief The amount of edges
+    size_type count;
+    /// @brief The amount of edges the current storage can hold
+    size_type maximum;
+    /// @brief The inline storage, used as long as there are at most N edges
+    E *inlineEdges[N];
+
+    bool isInline() const { return this->data == this->inlineEdges; }
+    void reallocate(size_type capacity);
+};
+
+/// @brief Initializes an empty list using the inline storage
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+AdjacencyList<E, N>::AdjacencyList()
+{
+    this->data = this->inlineEdges;
+    this->count = 0;
+    this->maximum = N;
+}
+
+/// @brief Copies the edge pointers of another list, not the edges themselves
+/// @param other Another list
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+AdjacencyList<E, N>::AdjacencyList(const AdjacencyList &other) : AdjacencyList()
+{
+    *this = other;
+}
+
+/// @brief Takes the storage of another list, which is left empty
+/// @param other Another list
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+AdjacencyList<E, N>::AdjacencyList(AdjacencyList &&other) noexcept : AdjacencyList()
+{
+    *this = std::move(other);
+}
+
+/// @brief Copies the edge pointers of another list, not the edges themselves
+/// @param other Another list
+/// @returns This list
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+AdjacencyList<E, N> &AdjacencyList<E, N>::operator=(const AdjacencyList &other)
+{
+    if (this != &other)
+    {
+        this->count = 0;
+        this->reserve(other.count);
+        std::copy(other.begin(), other.end(), this->data);
+        this->count = other.count;
+    }
+    return *this;
+}
+
+/// @brief Takes the storage of another list, which is left empty
+/// @param other Another list
+/// @returns This list
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+AdjacencyList<E, N> &AdjacencyList<E, N>::operator=(AdjacencyList &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (!this->isInline())
+        {
+            std::allocator<E *>().deallocate(this->data, this->maximum);
+        }
+        if (other.isInline())
+        {
+            this->data = this->inlineEdges;
+            this->maximum = N;
+            std::copy(other.begin(), other.end(), this->data);
+        }
+        else
+        {
+            this->data = other.data;
+            this->maximum = other.maximum;
+        }
+        this->count = other.count;
+        other.data = other.inlineEdges;
+        other.count = 0;
+        other.maximum = N;
+    }
+    return *this;
+}
+
+/// @brief Frees the heap storage, the edges are not deleted
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+AdjacencyList<E, N>::~AdjacencyList()
+{
+    if (!this->isInline())
+    {
+        std::allocator<E *>().deallocate(this->data, this->maximum);
+    }
+}
+
+/// @brief Appends an edge
+/// @param edge An edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+void AdjacencyList<E, N>::push_back(E *edge)
+{
+    if (this->count == this->maximum)
+    {
+        this->reallocate(2 * this->maximum);
+    }
+    this->data[this->count] = edge;
+    this->count++;
+}
+
+/// @brief Removes the last edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+void AdjacencyList<E, N>::pop_back()
+{
+    this->count--;
+}
+
+/// @brief Removes an edge by moving the last edge into its position
+/// @param position The position of the edge to remove
+/// @returns The same position, which holds the next edge to visit
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+typename AdjacencyList<E, N>::iterator AdjacencyList<E, N>::erase(iterator position)
+{
+    *position = this->back();
+    this->count--;
+    return position;
+}
+
+/// @brief Removes every occurrence of an edge
+/// @param edge An edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+void AdjacencyList<E, N>::remove(E *edge)
+{
+    iterator it = this->begin();
+    while (it != this->end())
+    {
+        if (*it == edge)
+        {
+            it = this->erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+/// @brief Removes every edge, the storage is kept
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+void AdjacencyList<E, N>::clear()
+{
+    this->count = 0;
+}
+
+/// @brief Makes sure the list can hold an amount of edges without reallocating
+/// @param capacity The amount of edges
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+void AdjacencyList<E, N>::reserve(size_type capacity)
+{
+    if (capacity > this->maximum)
+    {
+        this->reallocate(capacity);
+    }
+}
+
+/// @brief Releases the unused storage, going back to the inline storage if possible
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+void AdjacencyList<E, N>::shrink_to_fit()
+{
+    if (!this->isInline() && this->count < this->maximum)
+    {
+        this->reallocate(this->count);
+    }
+}
+
+/// @brief Moves the edges to a storage of another capacity
+/// @param capacity The new capacity, at least the amount of edges
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E, unsigned N>
+void AdjacencyList<E, N>::reallocate(size_type capacity)
+{
+    E **storage = this->inlineEdges;
+    if (capacity > N)
+    {
+        storage = std::allocator<E *>().allocate(capacity);
+    }
+    else
+    {
+        capacity = N;
+    }
+    if (storage != this->data)
+    {
+        std::memmove(storage, this->data, this->count * sizeof(E *));
+        if (!this->isInline())
+        {
+            std::allocator<E *>().deallocate(this->data, this->maximum);
+        }
+    }
+    this->data = storage;
+    this->maximum = capacity;
+}
+
+#endif // ADJACENCY_LIST_H
@@ -0,0 +1,325 @@
+#ifndef BREADTH_FIRST_SEARCH_H
+#define BREADTH_FIRST_SEARCH_H
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "csr_view.h"
+#include "thread_pool.h"
+
+/// @brief Result of a breadth-first search, see BreadthFirstSearch::run()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The result is a plain value indexed by the vertex ids of the CSR view the search ran on.
+struct BreadthFirstTree
+{
+    /// @brief Value used for an absent vertex id
+    static constexpr uint32_t NO_VERTEX = UINT32_MAX;
+    /// @brief Level of the vertices that cannot be reached
+    static constexpr uint32_t UNREACHABLE = UINT32_MAX;
+
+    /// @brief The id of the starting vertex
+    uint32_t startingVertexId = NO_VERTEX;
+    /// @brief Maps a vertex id to its amount of edges from the starting vertex, UNREACHABLE if it cannot be reached
+    std::vector<uint32_t> levels;
+    /// @brief Maps a vertex id to the vertex from which it was discovered,
+    /// NO_VERTEX for the starting vertex and the vertices that cannot be reached
+    std::vector<uint32_t> parents;
+    /// @brief The amount of vertices reached, including the starting vertex
+    uint32_t nbReached = 0;
+};
+
+/// @brief Parallel direction-optimizing breadth-first search over a CSR view
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Each level is explored either top-down, from the vertices of the frontier to their unvisited targets,
+/// or bottom-up, from each unvisited vertex to a source in the frontier, stopping at the first one found.
+/// Top-down is cheaper while the frontier is small; once its edges outnumber a fraction of the unexplored ones,
+/// bottom-up skips most of them, until the frontier shrinks again (Beamer, Asanović and Patterson, 2012).
+/// The levels are split in chunks run by a thread pool, and the searches are deterministic in their levels,
+/// though not in their parents when several vertices of a level could have discovered the same vertex.
+///
+/// Bottom-up steps follow the edges backwards. The engine builds flat arrays of the incoming edges when it is created,
+/// unless the view is symmetric, as the snapshot of an undirected graph is, in which case the outgoing edges are used.
+/// The engine refers to the view and the pool, which must outlive it, and can run any amount of searches.
+template <typename W = int> class BreadthFirstSearch
+{
+public:
+    BreadthFirstSearch(const CsrView<W> &graph, ThreadPool *pool = nullptr, bool symmetric = false);
+
+    BreadthFirstTree run(uint32_t startingVertex) const;
+
+    /// @brief A top-down step switches to bottom-up when the edges of the frontier exceed the unexplored ones divided by this
+    static constexpr uint64_t TOP_DOWN_FACTOR = 15;
+    /// @brief A bottom-up step switches to top-down when the frontier is smaller than the vertices divided by this
+    static constexpr uint64_t BOTTOM_UP_FACTOR = 18;
+
+private:
+    /// @brief The amount of vertices per chunk of a parallel step, a multiple of 64 so that threads write distinct bitmap words
+    static constexpr size_t GRAIN_SIZE = 1024;
+    /// @brief The vertex id used as parent of the starting vertex during the search, replaced by NO_VERTEX in the result
+    static constexpr uint32_t ROOT = UINT32_MAX - 1;
+
+    uint32_t getIncomingFirst(uint32_t id) const;
+    uint32_t getIncomingLast(uint32_t id) const;
+    uint32_t getIncomingSource(uint32_t index) const;
+
+    /// @brief The searched view
+    const CsrView<W> &graph;
+    /// @brief The pool running the steps, nullptr to run them on the calling thread
+    ThreadPool *pool;
+    /// @brief Whether the incoming edges are the outgoing ones
+    bool symmetric;
+    /// @brief The incoming edges of the vertex `id` are the range [incomingOffsets[id], incomingOffsets[id + 1]) of incomingSources,
+    /// empty if the view is symmetric
+    std::vector<uint32_t> incomingOffsets;
+    /// @brief The source vertex id of each incoming edge
+    std::vector<uint32_t> incomingSources;
+};
+
+/// @brief Initializes the engine, building the incoming edges of non-symmetric views
+/// @param graph The view to search
+/// @param pool The pool running the steps, nullptr to run them on the calling thread
+/// @param symmetric Whether each edge of the view has an edge in the opposite direction
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+BreadthFirstSearch<W>::BreadthFirstSearch(const CsrView<W> &graph, ThreadPool *pool, bool symmetric)
+    : graph(graph), pool(pool), symmetric(symmetric)
+{
+    if (symmetric)
+    {
+        return;
+    }
+    uint32_t nbVertices = graph.getNbVertices();
+    this->incomingOffsets.assign(nbVertices + 1, 0);
+    for (uint32_t e = 0; e < graph.getNbArcs(); e++)
+    {
+        this->incomingOffsets[graph.getEdgeTarget(e) + 1]++;
+    }
+    for (uint32_t id = 0; id < nbVertices; id++)
+    {
+        this->incomingOffsets[id + 1] += this->incomingOffsets[id];
+    }
+    this->incomingSources.resize(graph.getNbArcs());
+    std::vector<uint32_t> nextSlot(this->incomingOffsets.begin(), this->incomingOffsets.end() - 1);
+    for (uint32_t id = 0; id < nbVertices; id++)
+    {
+        for (uint32_t e = graph.getFirstEdge(id); e < graph.getLastEdge(id); e++)
+        {
+            this->incomingSources[nextSlot[graph.getEdgeTarget(e)]++] = id;
+        }
+    }
+}
+
+/// @brief Returns the first index of the incoming edges of a vertex
+/// @param id A vertex id
+/// @returns The first index, to be passed to getIncomingSource()
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t BreadthFirstSearch<W>::getIncomingFirst(uint32_t id) const
+{
+    return this->symmetric ? this->graph.getFirstEdge(id) : this->incomingOffsets[id];
+}
+
+/// @brief Returns the index following the last index of the incoming edges of a vertex
+/// @param id A vertex id
+/// @returns The end of the range of indices
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t BreadthFirstSearch<W>::getIncomingLast(uint32_t id) const
+{
+    return this->symmetric ? this->graph.getLastEdge(id) : this->incomingOffsets[id + 1];
+}
+
+/// @brief Returns the source vertex of an incoming edge
+/// @param index The index of the incoming edge
+/// @returns The source vertex id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t BreadthFirstSearch<W>::getIncomingSource(uint32_t index) const
+{
+    return this->symmetric ? this->graph.getEdgeTarget(index) : this->incomingSources[index];
+}
+
+/// @brief Runs a breadth-first search from a starting vertex
+/// @param startingVertex The id of the starting vertex
+/// @returns The level and parent of each vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+BreadthFirstTree BreadthFirstSearch<W>::run(uint32_t startingVertex) const
+{
+    uint32_t nbVertices = this->graph.getNbVertices();
+    BreadthFirstTree tree;
+    tree.startingVertexId = startingVertex;
+    tree.levels.assign(nbVertices, BreadthFirstTree::UNREACHABLE);
+    if (startingVertex >= nbVertices)
+    {
+        tree.parents.assign(nbVertices, BreadthFirstTree::NO_VERTEX);
+        return tree;
+    }
+
+    ThreadPool sequential(1);
+    ThreadPool &pool = this->pool != nullptr ? *this->pool : sequential;
+    unsigned nbThreads = pool.getNbThreads();
+
+    // The parents are claimed with a compare-and-swap by the top-down steps, several sources possibly reaching the same target
+    std::unique_ptr<std::atomic<uint32_t>[]> parents(new std::atomic<uint32_t>[nbVertices]);
+    pool.parallelFor(0, nbVertices, GRAIN_SIZE, [&](size_t begin, size_t end, unsigned)
+                     {
+        for (size_t id = begin; id < end; id++)
+        {
+            parents[id].store(BreadthFirstTree::NO_VERTEX, std::memory_order_relaxed);
+        } });
+    parents[startingVertex].store(ROOT, std::memory_order_relaxed);
+    tree.levels[startingVertex] = 0;
+
+    // The frontier is a list of vertex ids during top-down steps and a bitmap during bottom-up steps
+    std::vector<uint32_t> frontier(1, startingVertex);
+    std::vector<uint64_t> frontierBitmap;
+    std::vector<uint64_t> nextBitmap;
+    bool bottomUp = false;
+    uint64_t frontierEdges = this->graph.getVertexOutdegree(startingVertex);
+    uint64_t unexploredEdges = this->graph.getNbArcs() - frontierEdges;
+    uint64_t frontierSize = 1;
+    uint32_t nbReached = 1;
+
+    // Per-thread buffers and counters, merged at the end of each step
+    std::vector<std::vector<uint32_t>> discovered(nbThreads);
+    std::vector<uint64_t> discoveredEdges(nbThreads);
+    std::vector<uint64_t> discoveredCounts(nbThreads);
+
+    for (uint32_t level = 1; frontierSize > 0; level++)
+    {
+        // SWITCHING DIRECTION
+        if (!bottomUp && frontierEdges > unexploredEdges / TOP_DOWN_FACTOR)
+        {
+            bottomUp = true;
+            frontierBitmap.assign((nbVertices + 63) / 64, 0);
+            for (uint32_t id : frontier)
+            {
+                frontierBitmap[id / 64] |= uint64_t(1) << (id % 64);
+            }
+        }
+        else if (bottomUp && frontierSize < nbVertices / BOTTOM_UP_FACTOR)
+        {
+            bottomUp = false;
+            for (std::vector<uint32_t> &ids : discovered)
+            {
+                ids.clear();
+            }
+            pool.parallelFor(0, nbVertices, GRAIN_SIZE, [&](size_t begin, size_t end, unsigned threadIndex)
+                             {
+                for (size_t id = begin; id < end; id++)
+                {
+                    if (frontierBitmap[id / 64] & (uint64_t(1) << (id % 64)))
+                    {
+                        discovered[threadIndex].push_back(id);
+                    }
+                } });
+            frontier.clear();
+            for (std::vector<uint32_t> &ids : discovered)
+            {
+                frontier.insert(frontier.end(), ids.begin(), ids.end());
+            }
+        }
+
+        std::fill(discoveredEdges.begin(), discoveredEdges.end(), 0);
+        std::fill(discoveredCounts.begin(), discoveredCounts.end(), 0);
+
+        if (!bottomUp)
+        {
+            // TOP-DOWN STEP
+            for (std::vector<uint32_t> &ids : discovered)
+            {
+                ids.clear();
+            }
+            pool.parallelFor(0, frontier.size(), GRAIN_SIZE / 16, [&](size_t begin, size_t end, unsigned threadIndex)
+                             {
+                for (size_t i = begin; i < end; i++)
+                {
+                    uint32_t vertex = frontier[i];
+                    for (uint32_t e = this->graph.getFirstEdge(vertex); e < this->graph.getLastEdge(vertex); e++)
+                    {
+                        uint32_t target = this->graph.getEdgeTarget(e);
+                        uint32_t unclaimed = BreadthFirstTree::NO_VERTEX;
+                        if (parents[target].load(std::memory_order_relaxed) == BreadthFirstTree::NO_VERTEX &&
+                            parents[target].compare_exchange_strong(unclaimed, vertex, std::memory_order_relaxed))
+                        {
+                            tree.levels[target] = level;
+                            discovered[threadIndex].push_back(target);
+                            discoveredEdges[threadIndex] += this->graph.getVertexOutdegree(target);
+                        }
+                    }
+                } });
+            frontier.clear();
+            for (std::vector<uint32_t> &ids : discovered)
+            {
+                frontier.insert(frontier.end(), ids.begin(), ids.end());
+            }
+            frontierSize = frontier.size();
+        }
+        else
+        {
+            // BOTTOM-UP STEP
+            nextBitmap.assign(frontierBitmap.size(), 0);
+            pool.parallelFor(0, nbVertices, GRAIN_SIZE, [&](size_t begin, size_t end, unsigned threadIndex)
+                             {
+                for (size_t id = begin; id < end; id++)
+                {
+                    if (parents[id].load(std::memory_order_relaxed) != BreadthFirstTree::NO_VERTEX)
+                    {
+                        continue;
+                    }
+                    for (uint32_t i = this->getIncomingFirst(id); i < this->getIncomingLast(id); i++)
+                    {
+                        uint32_t source = this->getIncomingSource(i);
+                        if (frontierBitmap[source / 64] & (uint64_t(1) << (source % 64)))
+                        {
+                            parents[id].store(source, std::memory_order_relaxed);
+                            tree.levels[id] = level;
+                            nextBitmap[id / 64] |= uint64_t(1) << (id % 64);
+                            discoveredCounts[threadIndex]++;
+                            discoveredEdges[threadIndex] += this->graph.getVertexOutdegree(id);
+                            break;
+                        }
+                    }
+                } });
+            std::swap(frontierBitmap, nextBitmap);
+            frontierSize = 0;
+            for (uint64_t count : discoveredCounts)
+            {
+                frontierSize += count;
+            }
+        }
+
+        frontierEdges = 0;
+        for (uint64_t edges : discoveredEdges)
+        {
+            frontierEdges += edges;
+        }
+        unexploredEdges -= std::min(unexploredEdges, frontierEdges);
+        nbReached += frontierSize;
+    }
+
+    tree.parents.resize(nbVertices);
+    pool.parallelFor(0, nbVertices, GRAIN_SIZE, [&](size_t begin, size_t end, unsigned)
+                     {
+        for (size_t id = begin; id < end; id++)
+        {
+            uint32_t parent = parents[id].load(std::memory_order_relaxed);
+            tree.parents[id] = parent == ROOT ? BreadthFirstTree::NO_VERTEX : parent;
+        } });
+    tree.nbReached = nbReached;
+    return tree;
+}
+
+#endif // BREADTH_FIRST_SEARCH_H
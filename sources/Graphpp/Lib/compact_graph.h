@@ -0,0 +1,326 @@
+#ifndef COMPACT_GRAPH_H
+#define COMPACT_GRAPH_H
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "csr_view.h"
+#include "edge.h"
+#include "memory_usage.h"
+
+/// @brief Immutable compressed-sparse-row (CSR) snapshot of a graph, used for analysis workloads
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The CSR arrays are held in memory, and the analysis algorithms are the ones of CsrView.
+/// Each vertex id maps back to the original vertex and each edge id maps back to the original edge,
+/// so results computed on the snapshot can be reported on the graph it was built from.
+///
+/// A snapshot does not own anything : it must not outlive the vertices and edges it was built from.
+///
+/// The snapshot of an unweighted graph (W = void) has no weights array, and its shortest paths and spanning trees
+/// are computed with breadth-first searches.
+template <typename T, typename W = int> class CompactGraph : public CsrView<W>
+{
+public:
+    /// @brief The type used to pass and compute weights, int for unweighted graphs whose weights are all 1
+    typedef typename WeightTraits<W>::type Weight;
+
+    CompactGraph();
+    CompactGraph(std::vector<T *> vertices, std::vector<uint32_t> offsets, std::vector<uint32_t> targets,
+                 std::vector<Weight> weights, std::vector<Edge<T, W> *> edges);
+    CompactGraph(const CompactGraph &other);
+    CompactGraph(CompactGraph &&other) noexcept;
+    CompactGraph &operator=(const CompactGraph &other);
+    CompactGraph &operator=(CompactGraph &&other) noexcept;
+
+    // -- accessors --
+    bool isEmpty() const;
+    T *getVertex(uint32_t id) const;
+    uint32_t getVertexId(T *vertex) const;
+    Edge<T, W> *getEdge(uint32_t edgeId) const;
+    const std::vector<uint32_t> &getOffsets() const;
+    const std::vector<uint32_t> &getTargets() const;
+    const std::vector<Weight> &getWeights() const;
+    MemoryUsage memoryUsage() const;
+
+    // -- layout --
+    CompactGraph reorder(VertexOrder order) const;
+    CompactGraph reorder(const std::vector<uint32_t> &ordering) const;
+
+private:
+    /// @brief Maps a vertex id to the original vertex
+    std::vector<T *> vertices;
+    /// @brief Maps an original vertex to its id
+    std::unordered_map<T *, uint32_t> ids;
+    /// @brief The outgoing edges of the vertex `id` are the range [offsets[id], offsets[id + 1])
+    std::vector<uint32_t> offsetStorage;
+    /// @brief The target vertex id of each edge
+    std::vector<uint32_t> targetStorage;
+    /// @brief The weight of each edge, empty for unweighted graphs
+    std::vector<Weight> weightStorage;
+    /// @brief Maps an edge id to the original edge
+    std::vector<Edge<T, W> *> edges;
+
+    void bindArrays();
+};
+
+/// @brief Initializes an empty snapshot
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+CompactGraph<T, W>::CompactGraph()
+{
+    this->offsetStorage.push_back(0);
+    this->bindArrays();
+}
+
+/// @brief Initializes a snapshot from already built CSR arrays
+/// @param vertices The vertex of each vertex id
+/// @param offsets The first edge id of each vertex, followed by the total number of edges
+/// @param targets The target vertex id of each edge
+/// @param weights The weight of each edge, empty for unweighted graphs
+/// @param edges The original edge of each edge id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+CompactGraph<T, W>::CompactGraph(std::vector<T *> vertices, std::vector<uint32_t> offsets, std::vector<uint32_t> targets,
+                              std::vector<Weight> weights, std::vector<Edge<T, W> *> edges)
+    : vertices(std::move(vertices)), offsetStorage(std::move(offsets)), targetStorage(std::move(targets)),
+      weightStorage(std::move(weights)), edges(std::move(edges))
+{
+    this->ids.reserve(this->vertices.size());
+    for (uint32_t id = 0; id < this->vertices.size(); id++)
+    {
+        this->ids.insert(std::make_pair(this->vertices[id], id));
+    }
+    this->bindArrays();
+}
+
+/// @brief Copies another snapshot
+/// @param other Another snapshot
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+CompactGraph<T, W>::CompactGraph(const CompactGraph &other)
+{
+    *this = other;
+}
+
+/// @brief Takes the arrays of another snapshot
+/// @param other Another snapshot
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+CompactGraph<T, W>::CompactGraph(CompactGraph &&other) noexcept
+{
+    *this = std::move(other);
+}
+
+/// @brief Copies another snapshot
+/// @param other Another snapshot
+/// @returns This snapshot
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+CompactGraph<T, W> &CompactGraph<T, W>::operator=(const CompactGraph &other)
+{
+    this->vertices = other.vertices;
+    this->ids = other.ids;
+    this->offsetStorage = other.offsetStorage;
+    this->targetStorage = other.targetStorage;
+    this->weightStorage = other.weightStorage;
+    this->edges = other.edges;
+    this->bindArrays();
+    return *this;
+}
+
+/// @brief Takes the arrays of another snapshot
+/// @param other Another snapshot
+/// @returns This snapshot
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+CompactGraph<T, W> &CompactGraph<T, W>::operator=(CompactGraph &&other) noexcept
+{
+    this->vertices = std::move(other.vertices);
+    this->ids = std::move(other.ids);
+    this->offsetStorage = std::move(other.offsetStorage);
+    this->targetStorage = std::move(other.targetStorage);
+    this->weightStorage = std::move(other.weightStorage);
+    this->edges = std::move(other.edges);
+    this->bindArrays();
+    return *this;
+}
+
+/// @brief Points the view to the arrays of the snapshot, which must be done whenever they are replaced
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+void CompactGraph<T, W>::bindArrays()
+{
+    if (this->offsetStorage.empty())
+    {
+        this->offsetStorage.push_back(0);
+    }
+    this->setArrays(this->vertices.size(), this->targetStorage.size(), this->offsetStorage.data(), this->targetStorage.data(),
+                    this->weightStorage.empty() ? nullptr : this->weightStorage.data());
+}
+
+/// @brief Returns whether the snapshot has no vertex
+/// @returns Whether the snapshot is empty
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+bool CompactGraph<T, W>::isEmpty() const
+{
+    return this->vertices.empty();
+}
+
+/// @brief Returns the original vertex of a vertex id
+/// @param id A vertex id
+/// @returns The original vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+T *CompactGraph<T, W>::getVertex(uint32_t id) const
+{
+    return this->vertices[id];
+}
+
+/// @brief Returns the id of an original vertex
+/// @param vertex A vertex
+/// @returns The id of the vertex, NO_VERTEX if the vertex is not part of the snapshot
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+uint32_t CompactGraph<T, W>::getVertexId(T *vertex) const
+{
+    auto it = this->ids.find(vertex);
+    return it == this->ids.end() ? CsrView<W>::NO_VERTEX : it->second;
+}
+
+/// @brief Returns the original edge of an edge id
+/// @param edgeId An edge id
+/// @returns The original edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+Edge<T, W> *CompactGraph<T, W>::getEdge(uint32_t edgeId) const
+{
+    return this->edges[edgeId];
+}
+
+/// @brief Returns the offsets array
+/// @returns The first edge id of each vertex, followed by the total number of edges
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+const std::vector<uint32_t> &CompactGraph<T, W>::getOffsets() const
+{
+    return this->offsetStorage;
+}
+
+/// @brief Returns the targets array
+/// @returns The target vertex id of each edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+const std::vector<uint32_t> &CompactGraph<T, W>::getTargets() const
+{
+    return this->targetStorage;
+}
+
+/// @brief Returns the weights array
+/// @returns The weight of each edge, empty for unweighted graphs
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+const std::vector<typename CompactGraph<T, W>::Weight> &CompactGraph<T, W>::getWeights() const
+{
+    return this->weightStorage;
+}
+
+/// @brief Returns the memory footprint of the snapshot, broken down by category
+/// @returns The bytes used by the vertex table, the offsets and the edge arrays
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The offsets are counted as the adjacency, the targets, weights and original edges as the edges.
+/// The snapshot has no index nor cache, and the original edges it maps back to are not counted.
+template <typename T, typename W>
+MemoryUsage CompactGraph<T, W>::memoryUsage() const
+{
+    MemoryUsage usage;
+    usage.vertexTable = vectorMemoryUsage(this->vertices) + hashMemoryUsage(this->ids);
+    usage.adjacency = vectorMemoryUsage(this->offsetStorage);
+    usage.edges = vectorMemoryUsage(this->targetStorage) + vectorMemoryUsage(this->weightStorage) + vectorMemoryUsage(this->edges);
+    return usage;
+}
+
+/// @brief Returns a copy of the snapshot with its vertices relabelled to improve the locality of the traversals
+/// @param order The order of the vertices in the copy, see CsrView::getVertexOrdering()
+/// @returns The relabelled snapshot
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+CompactGraph<T, W> CompactGraph<T, W>::reorder(VertexOrder order) const
+{
+    return this->reorder(this->getVertexOrdering(order));
+}
+
+/// @brief Returns a copy of the snapshot with its vertices relabelled
+/// @param ordering The old id of each new id, a permutation of the vertex ids
+/// @returns The relabelled snapshot, whose vertex and edge ids still map back to the original vertices and edges
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The outgoing edges of each vertex are sorted by new target id, so that a traversal reads the per-vertex arrays forwards.
+/// The first vertex of the copy is no longer the first vertex of the graph, from which the algorithms of the graph start.
+template <typename T, typename W>
+CompactGraph<T, W> CompactGraph<T, W>::reorder(const std::vector<uint32_t> &ordering) const
+{
+    uint32_t nbVertices = this->getNbVertices();
+    std::vector<uint32_t> newIds(nbVertices);
+    std::vector<T *> vertices(nbVertices);
+    for (uint32_t newId = 0; newId < nbVertices; newId++)
+    {
+        newIds[ordering[newId]] = newId;
+        vertices[newId] = this->vertices[ordering[newId]];
+    }
+
+    std::vector<uint32_t> offsets;
+    offsets.reserve(nbVertices + 1);
+    std::vector<uint32_t> targets;
+    targets.reserve(this->nbArcs);
+    std::vector<Weight> weights;
+    weights.reserve(this->weightStorage.size());
+    std::vector<Edge<T, W> *> edges;
+    edges.reserve(this->nbArcs);
+    std::vector<std::pair<uint32_t, uint32_t>> outgoing; // pairs of (new target id, old edge id)
+    for (uint32_t oldId : ordering)
+    {
+        offsets.push_back(targets.size());
+        outgoing.clear();
+        for (uint32_t e = this->getFirstEdge(oldId); e < this->getLastEdge(oldId); e++)
+        {
+            outgoing.push_back(std::make_pair(newIds[this->targetStorage[e]], e));
+        }
+        std::sort(outgoing.begin(), outgoing.end());
+        for (auto const &edge : outgoing)
+        {
+            targets.push_back(edge.first);
+            if (!this->weightStorage.empty())
+            {
+                weights.push_back(this->weightStorage[edge.second]);
+            }
+            edges.push_back(this->edges[edge.second]);
+        }
+    }
+    offsets.push_back(targets.size());
+
+    return CompactGraph(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights), std::move(edges));
+}
+
+#endif // COMPACT_GRAPH_H
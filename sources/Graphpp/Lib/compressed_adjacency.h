@@ -0,0 +1,272 @@
+#ifndef COMPRESSED_ADJACENCY_H
+#define COMPRESSED_ADJACENCY_H
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include "csr_view.h"
+#include "memory_usage.h"
+
+/// @brief Read-only adjacency of a graph with its neighbour lists compressed, for structural scans of large sparse graphs
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The neighbour list of each vertex is sorted and gap-encoded : its degree, the difference between its first neighbour
+/// and the vertex itself, then the gaps between successive neighbours, each stored as a variable-length integer
+/// of 7 bits per byte. Neighbours of sparse graphs usually lie close to each other, so most values take a single byte
+/// instead of the 4 bytes of a CSR target, and the decoder returns those in a single step.
+///
+/// The compressed adjacency only holds the structure : it has no weights nor edge ids, and is meant for the
+/// breadth-first searches, connectivity checks and iterative scans (PageRank-like) that do not need them,
+/// which iterate the lists directly with forEachNeighbour(). Weighted algorithms keep running on a CsrView.
+///
+/// The vertex ids are the ones of the CSR view it was built from, typically a snapshot returned by Graph::freeze().
+/// The compressed lists of a graph must fit in 4 GiB.
+class CompressedAdjacency
+{
+public:
+    /// @brief Value used for an absent vertex id
+    static constexpr uint32_t NO_VERTEX = UINT32_MAX;
+    /// @brief Distance of the vertices that cannot be reached
+    static constexpr uint32_t UNREACHABLE = UINT32_MAX;
+
+    CompressedAdjacency();
+    template <typename W> explicit CompressedAdjacency(const CsrView<W> &graph);
+
+    // -- accessors --
+    uint32_t getNbVertices() const;
+    uint32_t getNbArcs() const;
+    uint32_t getVertexOutdegree(uint32_t id) const;
+    template <typename Function> void forEachNeighbour(uint32_t id, Function function) const;
+    std::vector<uint32_t> getNeighbours(uint32_t id) const;
+    MemoryUsage memoryUsage() const;
+
+    // -- analysis --
+    bool isConnected() const;
+    std::vector<uint32_t> getBreadthFirstDistances(uint32_t startingVertex) const;
+
+private:
+    static void encode(std::vector<uint8_t> &bytes, uint64_t value);
+    static uint64_t decode(const uint8_t *&position);
+
+    /// @brief The amount of arcs
+    uint32_t nbArcs = 0;
+    /// @brief The compressed list of the vertex `id` starts at bytes[offsets[id]], nbVertices + 1 entries
+    std::vector<uint32_t> offsets;
+    /// @brief The compressed neighbour lists, one after the other
+    std::vector<uint8_t> bytes;
+};
+
+/// @brief Initializes an empty adjacency
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline CompressedAdjacency::CompressedAdjacency()
+{
+    this->offsets.push_back(0);
+}
+
+/// @brief Compresses the adjacency of a CSR view
+/// @param graph A CSR view, in memory or mapped
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+CompressedAdjacency::CompressedAdjacency(const CsrView<W> &graph)
+{
+    uint32_t nbVertices = graph.getNbVertices();
+    this->nbArcs = graph.getNbArcs();
+    this->offsets.reserve(nbVertices + 1);
+    this->bytes.reserve(nbVertices + this->nbArcs + this->nbArcs / 4);
+
+    std::vector<uint32_t> neighbours;
+    for (uint32_t id = 0; id < nbVertices; id++)
+    {
+        this->offsets.push_back(this->bytes.size());
+
+        neighbours.clear();
+        for (uint32_t e = graph.getFirstEdge(id); e < graph.getLastEdge(id); e++)
+        {
+            neighbours.push_back(graph.getEdgeTarget(e));
+        }
+        std::sort(neighbours.begin(), neighbours.end());
+
+        encode(this->bytes, neighbours.size());
+        if (!neighbours.empty())
+        {
+            // the first neighbour is relative to the vertex, zigzag-encoded as it may come before it
+            int64_t first = int64_t(neighbours[0]) - id;
+            encode(this->bytes, first >= 0 ? uint64_t(first) << 1 : (uint64_t(-first) << 1) - 1);
+            for (size_t i = 1; i < neighbours.size(); i++)
+            {
+                encode(this->bytes, neighbours[i] - neighbours[i - 1]);
+            }
+        }
+    }
+    this->offsets.push_back(this->bytes.size());
+    this->bytes.shrink_to_fit();
+}
+
+/// @brief Appends a variable-length integer, 7 bits per byte from the lowest ones, the highest bit flagging a following byte
+/// @param bytes The bytes to append to
+/// @param value The value to encode
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline void CompressedAdjacency::encode(std::vector<uint8_t> &bytes, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        bytes.push_back(uint8_t(value) | 0x80);
+        value >>= 7;
+    }
+    bytes.push_back(uint8_t(value));
+}
+
+/// @brief Decodes a variable-length integer
+/// @param position The first byte of the integer, moved past its last byte
+/// @returns The decoded value
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline uint64_t CompressedAdjacency::decode(const uint8_t *&position)
+{
+    uint64_t value = *position++;
+    if (value < 0x80)
+    {
+        return value;
+    }
+    value &= 0x7F;
+    int shift = 7;
+    uint8_t byte;
+    do
+    {
+        byte = *position++;
+        value |= uint64_t(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+/// @brief Returns the amount of vertices
+/// @returns The amount of vertices
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline uint32_t CompressedAdjacency::getNbVertices() const
+{
+    return this->offsets.size() - 1;
+}
+
+/// @brief Returns the amount of directed arcs
+/// @returns The amount of arcs, an undirected edge being counted twice
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline uint32_t CompressedAdjacency::getNbArcs() const
+{
+    return this->nbArcs;
+}
+
+/// @brief Returns the outdegree of a vertex
+/// @param id A vertex id
+/// @returns The outdegree of the vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline uint32_t CompressedAdjacency::getVertexOutdegree(uint32_t id) const
+{
+    const uint8_t *position = this->bytes.data() + this->offsets[id];
+    return uint32_t(decode(position));
+}
+
+/// @brief Calls a function on each neighbour of a vertex, decoding its list on the fly
+/// @param id A vertex id
+/// @param function Called with the id of each neighbour, by increasing id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename Function>
+void CompressedAdjacency::forEachNeighbour(uint32_t id, Function function) const
+{
+    const uint8_t *position = this->bytes.data() + this->offsets[id];
+    uint32_t degree = uint32_t(decode(position));
+    if (degree == 0)
+    {
+        return;
+    }
+    uint64_t first = decode(position);
+    uint32_t neighbour = (first & 1) ? id - uint32_t((first + 1) >> 1) : id + uint32_t(first >> 1);
+    function(neighbour);
+    for (uint32_t i = 1; i < degree; i++)
+    {
+        neighbour += uint32_t(decode(position));
+        function(neighbour);
+    }
+}
+
+/// @brief Returns the neighbours of a vertex
+/// @param id A vertex id
+/// @returns The ids of the neighbours, sorted
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline std::vector<uint32_t> CompressedAdjacency::getNeighbours(uint32_t id) const
+{
+    std::vector<uint32_t> neighbours;
+    neighbours.reserve(this->getVertexOutdegree(id));
+    this->forEachNeighbour(id, [&neighbours](uint32_t neighbour)
+                           { neighbours.push_back(neighbour); });
+    return neighbours;
+}
+
+/// @brief Returns the memory footprint of the adjacency
+/// @returns The bytes used by the offsets, as the adjacency, and the compressed lists, as the edges
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline MemoryUsage CompressedAdjacency::memoryUsage() const
+{
+    MemoryUsage usage;
+    usage.adjacency = vectorMemoryUsage(this->offsets);
+    usage.edges = vectorMemoryUsage(this->bytes);
+    return usage;
+}
+
+/// @brief Returns whether every vertex can be reached from the first vertex
+/// @returns Whether the graph is connected
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Same semantics as CsrView::isConnected, the lists being decoded as the breadth-first search visits them.
+inline bool CompressedAdjacency::isConnected() const
+{
+    uint32_t nbVertices = this->getNbVertices();
+    if (nbVertices < 2)
+    {
+        return true;
+    }
+    std::vector<uint32_t> distances = this->getBreadthFirstDistances(0);
+    return std::find(distances.begin(), distances.end(), UNREACHABLE) == distances.end();
+}
+
+/// @brief Returns the amount of edges on the shortest paths from a starting vertex
+/// @param startingVertex The id of the starting vertex
+/// @returns The distance of each vertex, UNREACHABLE if it cannot be reached
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline std::vector<uint32_t> CompressedAdjacency::getBreadthFirstDistances(uint32_t startingVertex) const
+{
+    uint32_t nbVertices = this->getNbVertices();
+    std::vector<uint32_t> distances(nbVertices, UNREACHABLE);
+    std::vector<uint32_t> toVisit;
+    toVisit.reserve(nbVertices);
+
+    distances[startingVertex] = 0;
+    toVisit.push_back(startingVertex);
+    for (size_t next = 0; next < toVisit.size(); next++)
+    {
+        uint32_t vertex = toVisit[next];
+        uint32_t distance = distances[vertex] + 1;
+        this->forEachNeighbour(vertex, [&](uint32_t target)
+                               {
+            if (distances[target] == UNREACHABLE)
+            {
+                distances[target] = distance;
+                toVisit.push_back(target);
+            } });
+    }
+    return distances;
+}
+
+#endif // COMPRESSED_ADJACENCY_H
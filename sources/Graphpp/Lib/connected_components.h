@@ -0,0 +1,81 @@
+#ifndef CONNECTED_COMPONENTS_H
+#define CONNECTED_COMPONENTS_H
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+/// @brief Connected components of a graph, see Graph::getConnectedComponents()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The result is a plain value indexed by the vertex ids of the graph it was computed on.
+/// The components of a directed graph are its weakly connected components : the direction of the edges is ignored.
+/// Components are numbered from 0 in the order of their smallest vertex id.
+struct ConnectedComponents
+{
+    /// @brief Label of the ids that do not belong to any vertex
+    static constexpr uint32_t NO_COMPONENT = UINT32_MAX;
+
+    /// @brief Maps a vertex id to its component, NO_COMPONENT for the ids of removed vertices
+    std::vector<uint32_t> labels;
+    /// @brief Maps a component to its amount of vertices
+    std::vector<uint32_t> sizes;
+
+    /// @brief Returns the amount of components
+    /// @returns The amount of components, 0 for an empty graph
+    uint32_t getNbComponents() const
+    {
+        return this->sizes.size();
+    }
+
+    /// @brief Returns whether the graph is made of a single component
+    /// @returns Whether the graph is connected, which an empty graph is
+    bool isConnected() const
+    {
+        return this->sizes.size() <= 1;
+    }
+
+    /// @brief Returns the component of a vertex
+    /// @param id The id of the vertex
+    /// @returns The component, NO_COMPONENT if the id does not belong to a vertex
+    uint32_t getComponent(uint32_t id) const
+    {
+        return id < this->labels.size() ? this->labels[id] : NO_COMPONENT;
+    }
+
+    /// @brief Returns whether two vertices belong to the same component
+    /// @param id1 The id of a vertex
+    /// @param id2 The id of another vertex
+    /// @returns Whether they belong to the same component
+    bool areConnected(uint32_t id1, uint32_t id2) const
+    {
+        return this->getComponent(id1) != NO_COMPONENT && this->getComponent(id1) == this->getComponent(id2);
+    }
+};
+
+/// @brief Strongly connected components of a graph and their condensation, see Graph::getStronglyConnectedComponents()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The vertices of a strongly connected component can all be reached from each other by following the edges in their direction.
+/// Components are numbered in topological order of the condensation : every edge linking two components goes
+/// from a lower component to a higher one, so the component 0 cannot be reached from any other.
+struct StronglyConnectedComponents : ConnectedComponents
+{
+    /// @brief The edges of the condensation from the component `c` lead to the components
+    /// of the range [condensationOffsets[c], condensationOffsets[c + 1]) of condensationTargets, nbComponents + 1 entries
+    std::vector<uint32_t> condensationOffsets;
+    /// @brief The target component of each edge of the condensation, each pair of components being linked once at most
+    std::vector<uint32_t> condensationTargets;
+
+    /// @brief Returns the components reached from a component by a single edge
+    /// @param component A component
+    /// @returns The target components, all higher than the component
+    std::vector<uint32_t> getSuccessors(uint32_t component) const
+    {
+        return std::vector<uint32_t>(this->condensationTargets.begin() + this->condensationOffsets[component],
+                                     this->condensationTargets.begin() + this->condensationOffsets[component + 1]);
+    }
+};
+
+#endif // CONNECTED_COMPONENTS_H
@@ -0,0 +1,497 @@
+#ifndef CSR_VIEW_H
+#define CSR_VIEW_H
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "edge.h"
+#include "vertex_order.h"
+
+/// @brief Read-only view of a graph in compressed-sparse-row (CSR) form, and the analysis algorithms running over it
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Vertices are identified by dense ids ranging from 0 to getNbVertices() - 1.
+/// The outgoing edges of the vertex `id` are the edge ids ranging from offsets[id] to offsets[id + 1],
+/// their targets and weights being stored in two contiguous arrays.
+///
+/// The view does not own the arrays : CompactGraph points it to arrays in memory, MappedCsrGraph to a memory-mapped file,
+/// and the same traversals (breadth-first search, Dijkstra, Prim, coloring) run over both.
+/// Without weights array (W = void), every weight is 1, and the shortest paths and spanning trees
+/// are computed with breadth-first searches.
+template <typename W = int> class CsrView
+{
+public:
+    /// @brief The type used to pass and compute weights, int for unweighted graphs whose weights are all 1
+    typedef typename WeightTraits<W>::type Weight;
+
+    /// @brief Value used for an absent vertex id
+    static constexpr uint32_t NO_VERTEX = UINT32_MAX;
+    /// @brief Value used for an absent edge id
+    static constexpr uint32_t NO_EDGE = UINT32_MAX;
+    /// @brief Distance of the vertices that cannot be reached
+    static constexpr Weight UNREACHABLE = std::numeric_limits<Weight>::max();
+
+    // -- accessors --
+    uint32_t getNbVertices() const;
+    uint32_t getNbArcs() const;
+    uint32_t getEdgeSource(uint32_t edgeId) const;
+    uint32_t getEdgeTarget(uint32_t edgeId) const;
+    Weight getEdgeWeight(uint32_t edgeId) const;
+    uint32_t getFirstEdge(uint32_t id) const;
+    uint32_t getLastEdge(uint32_t id) const;
+    uint32_t getVertexOutdegree(uint32_t id) const;
+
+    // -- analysis --
+    bool isConnected() const;
+    int getChromaticNumber() const;
+    std::vector<uint32_t> getMinimumSpanningTree() const;
+    std::vector<uint32_t> getMinimumDistanceTree(uint32_t startingVertex, std::vector<Weight> *distances = nullptr) const;
+
+    // -- layout --
+    std::vector<uint32_t> getVertexOrdering(VertexOrder order) const;
+
+protected:
+    void setArrays(uint32_t nbVertices, uint32_t nbArcs, const uint32_t *offsets, const uint32_t *targets, const Weight *weights);
+
+    /// @brief The amount of vertices
+    uint32_t nbVertices = 0;
+    /// @brief The amount of arcs
+    uint32_t nbArcs = 0;
+    /// @brief The outgoing edges of the vertex `id` are the range [offsets[id], offsets[id + 1]), nbVertices + 1 entries
+    const uint32_t *offsets = nullptr;
+    /// @brief The target vertex id of each edge
+    const uint32_t *targets = nullptr;
+    /// @brief The weight of each edge, nullptr for unweighted graphs
+    const Weight *weights = nullptr;
+};
+
+/// @brief Points the view to CSR arrays
+/// @param nbVertices The amount of vertices
+/// @param nbArcs The amount of arcs
+/// @param offsets The first edge id of each vertex, followed by the total number of edges
+/// @param targets The target vertex id of each edge
+/// @param weights The weight of each edge, nullptr for unweighted graphs
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+void CsrView<W>::setArrays(uint32_t nbVertices, uint32_t nbArcs, const uint32_t *offsets, const uint32_t *targets, const Weight *weights)
+{
+    this->nbVertices = nbVertices;
+    this->nbArcs = nbArcs;
+    this->offsets = offsets;
+    this->targets = targets;
+    this->weights = weights;
+}
+
+/// @brief Returns the amount of vertices in the graph
+/// @returns The amount of vertices
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t CsrView<W>::getNbVertices() const
+{
+    return this->nbVertices;
+}
+
+/// @brief Returns the amount of directed arcs stored in the graph
+/// @returns The amount of arcs, an undirected edge being counted twice
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t CsrView<W>::getNbArcs() const
+{
+    return this->nbArcs;
+}
+
+/// @brief Returns the source vertex id of an edge
+/// @param edgeId An edge id
+/// @returns The source vertex id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The source is not stored, it is found with a binary search on the offsets in O(log V).
+template <typename W>
+uint32_t CsrView<W>::getEdgeSource(uint32_t edgeId) const
+{
+    return std::upper_bound(this->offsets, this->offsets + this->nbVertices + 1, edgeId) - this->offsets - 1;
+}
+
+/// @brief Returns the target vertex id of an edge
+/// @param edgeId An edge id
+/// @returns The target vertex id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t CsrView<W>::getEdgeTarget(uint32_t edgeId) const
+{
+    return this->targets[edgeId];
+}
+
+/// @brief Returns the weight of an edge
+/// @param edgeId An edge id
+/// @returns The weight of the edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+typename CsrView<W>::Weight CsrView<W>::getEdgeWeight(uint32_t edgeId) const
+{
+    if constexpr (WeightTraits<W>::weighted)
+    {
+        return this->weights[edgeId];
+    }
+    else
+    {
+        (void)edgeId;
+        return 1;
+    }
+}
+
+/// @brief Returns the first outgoing edge id of a vertex
+/// @param id A vertex id
+/// @returns The first outgoing edge id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t CsrView<W>::getFirstEdge(uint32_t id) const
+{
+    return this->offsets[id];
+}
+
+/// @brief Returns the id following the last outgoing edge id of a vertex
+/// @param id A vertex id
+/// @returns The end of the outgoing edge ids range
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t CsrView<W>::getLastEdge(uint32_t id) const
+{
+    return this->offsets[id + 1];
+}
+
+/// @brief Returns the outdegree of a vertex
+/// @param id A vertex id
+/// @returns The outdegree of the vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t CsrView<W>::getVertexOutdegree(uint32_t id) const
+{
+    return this->offsets[id + 1] - this->offsets[id];
+}
+
+/// @brief Returns whether every vertex can be reached from the first vertex
+/// @returns Whether the graph is connected
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The edges are followed in their direction only : on the snapshot of an undirected graph, which has both arcs of each edge,
+/// this is Graph::isConnected. Computed with a visited bitmap and a flat queue in O(V+E).
+template <typename W>
+bool CsrView<W>::isConnected() const
+{
+    uint32_t nbVertices = this->getNbVertices();
+    if (nbVertices < 2)
+    {
+        return true;
+    }
+
+    std::vector<bool> visited(nbVertices, false);
+    std::vector<uint32_t> toVisit;
+    toVisit.reserve(nbVertices);
+
+    visited[0] = true;
+    toVisit.push_back(0);
+    for (size_t next = 0; next < toVisit.size(); next++)
+    {
+        uint32_t currentVertex = toVisit[next];
+        for (uint32_t e = this->offsets[currentVertex]; e < this->offsets[currentVertex + 1]; e++)
+        {
+            uint32_t target = this->targets[e];
+            if (!visited[target])
+            {
+                visited[target] = true;
+                toVisit.push_back(target);
+            }
+        }
+    }
+    return toVisit.size() == nbVertices;
+}
+
+/// @brief Returns an estimation of the chromatic number of the graph
+/// @returns An upper bound of the chromatic number
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Same greedy algorithm as Graph::getChromaticNumber : vertices are colored in order of descending degree
+/// with the first color not used by one of their neighbours.
+template <typename W>
+int CsrView<W>::getChromaticNumber() const
+{
+    uint32_t nbVertices = this->getNbVertices();
+
+    // SORTING THE VERTICES
+    std::vector<uint32_t> degrees(nbVertices, 0);
+    for (uint32_t id = 0; id < nbVertices; id++)
+    {
+        degrees[id] += this->getVertexOutdegree(id);
+        for (uint32_t e = this->offsets[id]; e < this->offsets[id + 1]; e++)
+        {
+            degrees[this->targets[e]]++;
+        }
+    }
+    std::vector<uint32_t> verticesOrderedByDegree(nbVertices);
+    for (uint32_t id = 0; id < nbVertices; id++)
+    {
+        verticesOrderedByDegree[id] = id;
+    }
+    std::stable_sort(verticesOrderedByDegree.begin(), verticesOrderedByDegree.end(), [&degrees](uint32_t a, uint32_t b)
+                     { return degrees[a] > degrees[b]; });
+
+    // COLORING THE VERTICES
+    // 0 means not colored yet, usedBy[color] remembers the last vertex for which the color was seen in the neighbourhood
+    std::vector<int> colors(nbVertices, 0);
+    std::vector<uint32_t> usedBy(nbVertices + 2, NO_VERTEX);
+    int chromaticNumber = 0;
+    for (uint32_t vertex : verticesOrderedByDegree)
+    {
+        for (uint32_t e = this->offsets[vertex]; e < this->offsets[vertex + 1]; e++)
+        {
+            usedBy[colors[this->targets[e]]] = vertex;
+        }
+        int color = 1;
+        while (usedBy[color] == vertex)
+        {
+            color++;
+        }
+        colors[vertex] = color;
+        chromaticNumber = std::max(chromaticNumber, color);
+    }
+    return chromaticNumber;
+}
+
+/// @brief Returns the edges of a minimum spanning tree of the graph.
+/// @returns The edge ids of the tree
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// This method uses Prim's algorithm from the first vertex, with a binary heap and flat per-vertex arrays.
+/// On unweighted graphs, every spanning tree is minimal : the breadth-first search tree is returned.
+/// Only the edges in the direction of the discovery are returned.
+template <typename W>
+std::vector<uint32_t> CsrView<W>::getMinimumSpanningTree() const
+{
+    std::vector<uint32_t> tree;
+    uint32_t nbVertices = this->getNbVertices();
+    if (nbVertices == 0)
+    {
+        return tree;
+    }
+    tree.reserve(nbVertices - 1);
+
+    if constexpr (!WeightTraits<W>::weighted)
+    {
+        std::vector<uint32_t> predecessors = this->getMinimumDistanceTree(0);
+        for (uint32_t id = 0; id < nbVertices; id++)
+        {
+            if (predecessors[id] != NO_EDGE)
+            {
+                tree.push_back(predecessors[id]);
+            }
+        }
+        return tree;
+    }
+
+    // Pairs of (weight, edge id), out-of-date pairs are skipped when popped
+    std::priority_queue<std::pair<Weight, uint32_t>, std::vector<std::pair<Weight, uint32_t>>, std::greater<std::pair<Weight, uint32_t>>> toVisit;
+    std::vector<Weight> upToDatePrios(nbVertices, UNREACHABLE);
+    std::vector<bool> visited(nbVertices, false);
+
+    auto visit = [&](uint32_t vertex)
+    {
+        visited[vertex] = true;
+        for (uint32_t e = this->offsets[vertex]; e < this->offsets[vertex + 1]; e++)
+        {
+            uint32_t target = this->targets[e];
+            if (!visited[target] && this->getEdgeWeight(e) < upToDatePrios[target])
+            {
+                upToDatePrios[target] = this->getEdgeWeight(e);
+                toVisit.push(std::make_pair(this->getEdgeWeight(e), e));
+            }
+        }
+    };
+
+    visit(0);
+    while (!toVisit.empty())
+    {
+        std::pair<Weight, uint32_t> top = toVisit.top();
+        toVisit.pop();
+
+        uint32_t target = this->targets[top.second];
+        if (visited[target] || top.first > upToDatePrios[target])
+        {
+            continue;
+        }
+        tree.push_back(top.second);
+        visit(target);
+    }
+    return tree;
+}
+
+/// @brief Returns the shortest paths tree of the graph from a starting vertex.
+/// @param startingVertex The id of the starting vertex
+/// @param distances If not null, filled with the distance of each vertex, UNREACHABLE if it cannot be reached
+/// @returns The edge id through which each vertex is reached, NO_EDGE for the starting and the unreachable vertices
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// This method uses Dijkstra's algorithm with a binary heap and flat per-vertex arrays,
+/// or a breadth-first search with a flat queue on unweighted graphs.
+template <typename W>
+std::vector<uint32_t> CsrView<W>::getMinimumDistanceTree(uint32_t startingVertex, std::vector<Weight> *distances) const
+{
+    uint32_t nbVertices = this->getNbVertices();
+    std::vector<uint32_t> predecessors(nbVertices, NO_EDGE);
+    std::vector<Weight> upToDatePrios(nbVertices, UNREACHABLE);
+    std::vector<bool> visited(nbVertices, false);
+
+    if constexpr (!WeightTraits<W>::weighted)
+    {
+        std::vector<uint32_t> toVisit;
+        toVisit.reserve(nbVertices);
+        upToDatePrios[startingVertex] = 0;
+        toVisit.push_back(startingVertex);
+        for (size_t next = 0; next < toVisit.size(); next++)
+        {
+            uint32_t vertex = toVisit[next];
+            for (uint32_t e = this->offsets[vertex]; e < this->offsets[vertex + 1]; e++)
+            {
+                uint32_t target = this->targets[e];
+                if (upToDatePrios[target] == UNREACHABLE)
+                {
+                    upToDatePrios[target] = upToDatePrios[vertex] + 1;
+                    predecessors[target] = e;
+                    toVisit.push_back(target);
+                }
+            }
+        }
+        if (distances != nullptr)
+        {
+            *distances = std::move(upToDatePrios);
+        }
+        return predecessors;
+    }
+
+    // Pairs of (distance, vertex id), out-of-date pairs are skipped when popped
+    std::priority_queue<std::pair<Weight, uint32_t>, std::vector<std::pair<Weight, uint32_t>>, std::greater<std::pair<Weight, uint32_t>>> toVisit;
+    upToDatePrios[startingVertex] = 0;
+    toVisit.push(std::make_pair(0, startingVertex));
+    while (!toVisit.empty())
+    {
+        std::pair<Weight, uint32_t> top = toVisit.top();
+        toVisit.pop();
+
+        uint32_t vertex = top.second;
+        if (visited[vertex] || top.first > upToDatePrios[vertex])
+        {
+            continue;
+        }
+        visited[vertex] = true;
+
+        for (uint32_t e = this->offsets[vertex]; e < this->offsets[vertex + 1]; e++)
+        {
+            uint32_t target = this->targets[e];
+            Weight distance = top.first + this->weights[e];
+            if (!visited[target] && distance < upToDatePrios[target])
+            {
+                upToDatePrios[target] = distance;
+                predecessors[target] = e;
+                toVisit.push(std::make_pair(distance, target));
+            }
+        }
+    }
+
+    if (distances != nullptr)
+    {
+        *distances = std::move(upToDatePrios);
+    }
+    return predecessors;
+}
+
+/// @brief Computes a relabelling of the vertices that improves the locality of the traversals
+/// @param order The order to compute
+/// @returns The old id of each new id, a permutation of the vertex ids
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The breadth-first orders go through every connected part, in the order of their first vertex id,
+/// and follow the edges in their direction only. Ties are broken by the old ids and the order of the edges,
+/// so the ordering is deterministic.
+template <typename W>
+std::vector<uint32_t> CsrView<W>::getVertexOrdering(VertexOrder order) const
+{
+    uint32_t nbVertices = this->getNbVertices();
+    std::vector<uint32_t> ordering(nbVertices);
+    for (uint32_t id = 0; id < nbVertices; id++)
+    {
+        ordering[id] = id;
+    }
+    if (order == VertexOrder::Degree)
+    {
+        std::stable_sort(ordering.begin(), ordering.end(), [this](uint32_t a, uint32_t b)
+                         { return this->getVertexOutdegree(a) > this->getVertexOutdegree(b); });
+        return ordering;
+    }
+
+    // Breadth-first searches, started from each vertex not reached yet in the order of `starts`
+    std::vector<uint32_t> starts = std::move(ordering);
+    bool cuthillMcKee = order == VertexOrder::ReverseCuthillMcKee;
+    if (cuthillMcKee)
+    {
+        std::stable_sort(starts.begin(), starts.end(), [this](uint32_t a, uint32_t b)
+                         { return this->getVertexOutdegree(a) < this->getVertexOutdegree(b); });
+    }
+    ordering.clear();
+    ordering.reserve(nbVertices);
+    std::vector<bool> visited(nbVertices, false);
+    for (uint32_t start : starts)
+    {
+        if (visited[start])
+        {
+            continue;
+        }
+        visited[start] = true;
+        ordering.push_back(start);
+        for (size_t next = ordering.size() - 1; next < ordering.size(); next++)
+        {
+            uint32_t vertex = ordering[next];
+            size_t firstDiscovered = ordering.size();
+            for (uint32_t e = this->offsets[vertex]; e < this->offsets[vertex + 1]; e++)
+            {
+                uint32_t target = this->targets[e];
+                if (!visited[target])
+                {
+                    visited[target] = true;
+                    ordering.push_back(target);
+                }
+            }
+            if (cuthillMcKee)
+            {
+                std::sort(ordering.begin() + firstDiscovered, ordering.end(), [this](uint32_t a, uint32_t b)
+                          { return this->getVertexOutdegree(a) < this->getVertexOutdegree(b) ||
+                                   (this->getVertexOutdegree(a) == this->getVertexOutdegree(b) && a < b); });
+            }
+        }
+    }
+    if (cuthillMcKee)
+    {
+        std::reverse(ordering.begin(), ordering.end());
+    }
+    return ordering;
+}
+
+#endif // CSR_VIEW_H
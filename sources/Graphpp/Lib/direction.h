@@ -0,0 +1,27 @@
+#ifndef DIRECTION_H
+#define DIRECTION_H
+
+/// @brief Direction policy of a graph whose edges are arcs, followed from their source to their target
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Each direction between two vertices is stored as a separate edge. Whether the graph is actually oriented,
+/// i.e. whether some arc has no arc in the opposite direction, is computed from its contents by Graph::isOriented().
+struct Directed
+{
+    static constexpr bool directed = true;
+};
+
+/// @brief Direction policy of a graph whose edges can be followed both ways
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Each edge is stored once, in the adjacency list of the vertex it was added from, and the incoming edge index
+/// gives access to it from its other end. The graph is never oriented, and the degree of a vertex is both its indegree
+/// and its outdegree.
+struct Undirected
+{
+    static constexpr bool directed = false;
+};
+
+#endif // DIRECTION_H
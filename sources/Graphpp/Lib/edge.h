@@ -1,25 +1,129 @@
 #ifndef EDGE_H
 #define EDGE_H
+#include <cstdint>
+
+template <typename T, typename W, typename Direction, typename EdgeAllocator> class Graph;
+
+/// @brief Describes the type of the weights of the edges
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// `type` is the type used to pass and compute weights, `weighted` tells whether the edges store a weight at all.
+/// Unweighted edges (W = void) have no weight member, their weight is always 1.
+template <typename W> struct WeightTraits
+{
+    typedef W type;
+    static constexpr bool weighted = true;
+};
+
+template <> struct WeightTraits<void>
+{
+    typedef int type;
+    static constexpr bool weighted = false;
+};
 
 /// @brief Represents a graph edge as a member of an adjacency list and allows to handle the edges of a graph
 /// @author The Graph++ Development Team
 /// @date spring 2023
 ///
-/// An Edge is represented as a combination of a target vertex and a weight.
-/// The source vertex is not included as the edge belongs to the adjacency list corresponding to the source vertex.
-template <typename T> class Edge {
+/// An Edge is represented as a combination of a target vertex and a weight of type W.
+/// It belongs to the adjacency list of its source vertex, which it also knows, so that the graph can go straight to that list.
+/// The two edges created by a graph in opposite directions between the same vertices are linked as twins.
+template <typename T, typename W = int> class Edge {
 private:
     /// @brief The target vertex
     T* target;
+    /// @brief The source vertex, set by the graph the edge is added to
+    T* source;
+    /// @brief The edge in the opposite direction, if both were created by the same graph
+    Edge<T, W>* twin;
     /// @brief The weight of the edge
-    int weight;
+    W weight;
+    /// @brief The id of the target vertex in the graph which created the edge
+    ///
+    /// Only a hint : the edge can be shared with another graph, which checks the hint against its own vertex table.
+    uint32_t targetIdHint;
+
+    template <typename, typename, typename, typename>
+    friend class Graph;
 
 public:
     Edge(); //Default constructor for arrays
-    Edge(T *target, int weight = 1);
+    Edge(T *target, W weight = 1);
     T* getTarget();
-    int getWeight();
-    void setWeight(int weight);
+    T* getSource();
+    Edge<T, W>* getTwin();
+    W getWeight();
+    void setWeight(W weight);
+};
+
+/// @brief Represents an unweighted graph edge, which only stores its target vertex
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Same interface as Edge, except for setWeight() : the weight of an unweighted edge is always 1,
+/// so the algorithms written for weighted edges keep working, and the compiler folds the weights away.
+template <typename T> class Edge<T, void> {
+private:
+    /// @brief The target vertex
+    T* target;
+    /// @brief The source vertex, set by the graph the edge is added to
+    T* source;
+    /// @brief The edge in the opposite direction, if both were created by the same graph
+    Edge<T, void>* twin;
+    /// @brief The id of the target vertex in the graph which created the edge
+    ///
+    /// Only a hint : the edge can be shared with another graph, which checks the hint against its own vertex table.
+    uint32_t targetIdHint;
+
+    template <typename, typename, typename, typename>
+    friend class Graph;
+
+public:
+    /// @brief A simple edge constructor
+    /// @param target The target vertex
+    /// @param weight Ignored, for compatibility with weighted edges
+    /// @author The Graph++ Development Team
+    /// @date 17.10.2026
+    Edge(T *target, int weight = 1){
+        (void)weight;
+        this->target = target;
+        this->source = nullptr;
+        this->twin = nullptr;
+        this->targetIdHint = UINT32_MAX;
+    }
+
+    /// @brief Returns the target vertex of the edge
+    /// @returns The target vertex of the edge
+    /// @author The Graph++ Development Team
+    /// @date 17.10.2026
+    T* getTarget(){
+        return this->target;
+    }
+
+    /// @brief Returns the source vertex of the edge
+    /// @returns The source vertex, nullptr if the edge was never added to a graph
+    /// @author The Graph++ Development Team
+    /// @date 17.10.2026
+    T* getSource(){
+        return this->source;
+    }
+
+    /// @brief Returns the edge in the opposite direction
+    /// @returns The twin edge, nullptr if there is none
+    /// @author The Graph++ Development Team
+    /// @date 17.10.2026
+    Edge<T, void>* getTwin(){
+        return this->twin;
+    }
+
+    /// @brief Returns the weight of the edge
+    /// @returns Always 1
+    /// @author The Graph++ Development Team
+    /// @date 17.10.2026
+    constexpr int getWeight() const{
+        return 1;
+    }
 };
 
 /// @brief A simple edge constructor
@@ -27,24 +131,45 @@ public:
 /// @param weight The weight of the edge
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T> Edge<T>::Edge(T *target, int weight){
+template <typename T, typename W> Edge<T, W>::Edge(T *target, W weight){
     this->target = target;
+    this->source = nullptr;
+    this->twin = nullptr;
     this->weight = weight;
+    this->targetIdHint = UINT32_MAX;
 }
 
 /// @brief Returns the target vertex of the edge
 /// @returns The target vertex of the edge
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T> T* Edge<T>::getTarget(){
+template <typename T, typename W> T* Edge<T, W>::getTarget(){
     return this->target;
 }
 
+/// @brief Returns the source vertex of the edge
+/// @returns The source vertex, nullptr if the edge was never added to a graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W> T* Edge<T, W>::getSource(){
+    return this->source;
+}
+
+/// @brief Returns the edge in the opposite direction
+/// @returns The twin edge, nullptr if there is none
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Twins are linked by the graph which created both edges, and unlinked when one of them is removed from it.
+template <typename T, typename W> Edge<T, W>* Edge<T, W>::getTwin(){
+    return this->twin;
+}
+
 /// @brief Returns the weight of the edge
 /// @returns The weight of the edge
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T> int Edge<T>::getWeight(){
+template <typename T, typename W> W Edge<T, W>::getWeight(){
     return this->weight;
 }
 
@@ -52,7 +177,7 @@ template <typename T> int Edge<T>::getWeight(){
 /// @param weight The weight to set
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T> void Edge<T>::setWeight(int weight){
+template <typename T, typename W> void Edge<T, W>::setWeight(W weight){
     this->weight = weight;
 }
 
@@ -0,0 +1,441 @@
+#ifndef EDGE_ALLOCATOR_H
+#define EDGE_ALLOCATOR_H
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "memory_usage.h"
+
+/// @brief Allocates the edges of a graph in slabs and releases them all at once
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Edges are constructed in place in contiguous slabs whose size doubles up to a maximum,
+/// so building a graph costs one heap allocation per slab instead of one per edge.
+/// A destroyed edge leaves a hole that is reused by the next created edge.
+/// An edge never moves, so the edge pointers held by the adjacency lists and the application stay valid
+/// until the edge is destroyed or the pool is cleared.
+///
+/// Every allocator usable by Graph provides create(), destroy(), owns(), clear(), reserve(), memoryUsage() and swap(),
+/// and can be moved but not copied.
+template <typename E> class EdgePool
+{
+    static_assert(std::is_trivially_destructible<E>::value, "Pooled edges are released in bulk without calling their destructor");
+
+public:
+    explicit EdgePool(size_t firstSlabSize = 64);
+    EdgePool(const EdgePool &) = delete;
+    EdgePool &operator=(const EdgePool &) = delete;
+    EdgePool(EdgePool &&other) noexcept;
+    EdgePool &operator=(EdgePool &&other) noexcept;
+    ~EdgePool();
+
+    template <typename... Args>
+    E *create(Args &&...args);
+    void destroy(E *edge);
+    bool owns(const E *edge) const;
+    void clear();
+    void reserve(size_t nbEdges);
+    size_t getNbEdges() const;
+    size_t getCapacity() const;
+    size_t memoryUsage() const;
+    void swap(EdgePool &other) noexcept;
+
+private:
+    /// @brief The maximum amount of edges in a slab
+    static constexpr size_t MAX_SLAB_SIZE = 65536;
+
+    /// @brief The allocated slabs, as pairs of (storage, capacity)
+    std::vector<std::pair<E *, size_t>> slabs;
+    /// @brief The slabs as pairs of (storage, capacity) sorted by address, for owns()
+    std::vector<std::pair<E *, size_t>> slabsByAddress;
+    /// @brief The amount of slots already used in the last slab
+    size_t used = 0;
+    /// @brief The capacity of the first slab
+    size_t firstSlabSize;
+    /// @brief The slots of the destroyed edges, reused first
+    std::vector<E *> freeSlots;
+    /// @brief The amount of living edges
+    size_t nbEdges = 0;
+
+    void addSlab(size_t capacity);
+};
+
+/// @brief Initializes an empty pool, no memory is allocated before the first edge
+/// @param firstSlabSize The capacity of the first slab
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+EdgePool<E>::EdgePool(size_t firstSlabSize)
+{
+    this->firstSlabSize = firstSlabSize > 0 ? firstSlabSize : 1;
+}
+
+/// @brief Takes over the slabs of another pool, which is left empty
+/// @param other The pool to move from
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// No edge moves, so the pointers to the edges of the other pool stay valid and are now owned by this pool.
+template <typename E>
+EdgePool<E>::EdgePool(EdgePool &&other) noexcept
+    : firstSlabSize(other.firstSlabSize)
+{
+    this->swap(other);
+}
+
+/// @brief Releases every slab, then takes over the slabs of another pool, which is left empty
+/// @param other The pool to move from
+/// @returns This pool
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+EdgePool<E> &EdgePool<E>::operator=(EdgePool &&other) noexcept
+{
+    if (this != &other)
+    {
+        this->clear();
+        this->swap(other);
+    }
+    return *this;
+}
+
+/// @brief Releases every slab
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+EdgePool<E>::~EdgePool()
+{
+    this->clear();
+}
+
+/// @brief Constructs a new edge in the pool
+/// @param args The arguments of the edge constructor
+/// @returns The new edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+template <typename... Args>
+E *EdgePool<E>::create(Args &&...args)
+{
+    E *slot;
+    if (!this->freeSlots.empty())
+    {
+        slot = this->freeSlots.back();
+        this->freeSlots.pop_back();
+    }
+    else
+    {
+        if (this->slabs.empty() || this->used == this->slabs.back().second)
+        {
+            this->addSlab(this->slabs.empty() ? this->firstSlabSize : std::min(2 * this->slabs.back().second, MAX_SLAB_SIZE));
+        }
+        slot = this->slabs.back().first + this->used;
+        this->used++;
+    }
+    this->nbEdges++;
+    return new (slot) E(std::forward<Args>(args)...);
+}
+
+/// @brief Destroys an edge created by this pool, its slot is reused by the next created edge
+/// @param edge An edge owned by the pool
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+void EdgePool<E>::destroy(E *edge)
+{
+    this->freeSlots.push_back(edge);
+    this->nbEdges--;
+}
+
+/// @brief Returns whether an edge was created by this pool
+/// @param edge An edge
+/// @returns Whether the edge lives in one of the slabs of the pool
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Binary search in the slabs sorted by address, O(log S) for S slabs.
+template <typename E>
+bool EdgePool<E>::owns(const E *edge) const
+{
+    std::less<const E *> less;
+    auto it = std::upper_bound(this->slabsByAddress.begin(), this->slabsByAddress.end(), edge, [&less](const E *address, std::pair<E *, size_t> const &slab)
+                               { return less(address, slab.first); });
+    if (it == this->slabsByAddress.begin())
+    {
+        return false;
+    }
+    --it;
+    return less(edge, it->first + it->second);
+}
+
+/// @brief Releases every edge of the pool at once
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Every pointer to an edge of the pool becomes invalid.
+template <typename E>
+void EdgePool<E>::clear()
+{
+    for (auto const &slab : this->slabs)
+    {
+        std::allocator<E>().deallocate(slab.first, slab.second);
+    }
+    this->slabs.clear();
+    this->slabsByAddress.clear();
+    this->freeSlots.clear();
+    this->used = 0;
+    this->nbEdges = 0;
+}
+
+/// @brief Makes sure an amount of edges can be created without allocating more than one slab
+/// @param nbEdges The amount of edges about to be created
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// If the free slots and the rest of the last slab are not enough, a slab large enough for the remaining edges is allocated,
+/// possibly larger than the maximum slab size. The rest of the previous last slab is then left unused.
+template <typename E>
+void EdgePool<E>::reserve(size_t nbEdges)
+{
+    size_t available = this->freeSlots.size();
+    if (!this->slabs.empty())
+    {
+        available += this->slabs.back().second - this->used;
+    }
+    if (nbEdges > available)
+    {
+        size_t capacity = nbEdges - this->freeSlots.size();
+        if (!this->slabs.empty())
+        {
+            capacity = std::max(capacity, std::min(2 * this->slabs.back().second, MAX_SLAB_SIZE));
+        }
+        this->addSlab(capacity);
+    }
+}
+
+/// @brief Allocates a new last slab
+/// @param capacity The capacity of the slab
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+void EdgePool<E>::addSlab(size_t capacity)
+{
+    std::pair<E *, size_t> slab = std::make_pair(std::allocator<E>().allocate(capacity), capacity);
+    this->slabs.push_back(slab);
+    this->slabsByAddress.insert(std::upper_bound(this->slabsByAddress.begin(), this->slabsByAddress.end(), slab, [](std::pair<E *, size_t> const &a, std::pair<E *, size_t> const &b)
+                                                 { return std::less<E *>()(a.first, b.first); }),
+                                slab);
+    this->used = 0;
+}
+
+/// @brief Returns the amount of living edges in the pool
+/// @returns The amount of edges
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+size_t EdgePool<E>::getNbEdges() const
+{
+    return this->nbEdges;
+}
+
+/// @brief Returns the bytes allocated by the pool
+/// @returns The size of the slabs and of the bookkeeping of the pool
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+size_t EdgePool<E>::memoryUsage() const
+{
+    return this->getCapacity() * sizeof(E) + vectorMemoryUsage(this->slabs) + vectorMemoryUsage(this->slabsByAddress) + vectorMemoryUsage(this->freeSlots);
+}
+
+/// @brief Exchanges the slabs, and so the edges, of two pools
+/// @param other The other pool
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+void EdgePool<E>::swap(EdgePool &other) noexcept
+{
+    this->slabs.swap(other.slabs);
+    this->slabsByAddress.swap(other.slabsByAddress);
+    std::swap(this->used, other.used);
+    std::swap(this->firstSlabSize, other.firstSlabSize);
+    this->freeSlots.swap(other.freeSlots);
+    std::swap(this->nbEdges, other.nbEdges);
+}
+
+/// @brief Returns the amount of edges the allocated slabs can hold
+/// @returns The capacity of the pool
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+size_t EdgePool<E>::getCapacity() const
+{
+    size_t capacity = 0;
+    for (auto const &slab : this->slabs)
+    {
+        capacity += slab.second;
+    }
+    return capacity;
+}
+
+/// @brief Allocates each edge of a graph separately on the heap
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Same interface as EdgePool, one heap allocation per edge. Mostly useful to compare with the pool
+/// or to debug edge lifetimes with memory checkers.
+template <typename E> class HeapEdgeAllocator
+{
+public:
+    HeapEdgeAllocator() = default;
+    HeapEdgeAllocator(const HeapEdgeAllocator &) = delete;
+    HeapEdgeAllocator &operator=(const HeapEdgeAllocator &) = delete;
+    HeapEdgeAllocator(HeapEdgeAllocator &&other) noexcept;
+    HeapEdgeAllocator &operator=(HeapEdgeAllocator &&other) noexcept;
+    ~HeapEdgeAllocator();
+
+    template <typename... Args>
+    E *create(Args &&...args);
+    void destroy(E *edge);
+    bool owns(const E *edge) const;
+    void clear();
+    void reserve(size_t nbEdges);
+    size_t getNbEdges() const;
+    size_t memoryUsage() const;
+    void swap(HeapEdgeAllocator &other) noexcept;
+
+private:
+    /// @brief The living edges
+    std::unordered_set<const E *> edges;
+};
+
+/// @brief Takes over the edges of another allocator, which is left empty
+/// @param other The allocator to move from
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+HeapEdgeAllocator<E>::HeapEdgeAllocator(HeapEdgeAllocator &&other) noexcept
+{
+    this->swap(other);
+}
+
+/// @brief Deletes every living edge, then takes over the edges of another allocator, which is left empty
+/// @param other The allocator to move from
+/// @returns This allocator
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+HeapEdgeAllocator<E> &HeapEdgeAllocator<E>::operator=(HeapEdgeAllocator &&other) noexcept
+{
+    if (this != &other)
+    {
+        this->clear();
+        this->swap(other);
+    }
+    return *this;
+}
+
+/// @brief Deletes every living edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+HeapEdgeAllocator<E>::~HeapEdgeAllocator()
+{
+    this->clear();
+}
+
+/// @brief Allocates a new edge
+/// @param args The arguments of the edge constructor
+/// @returns The new edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+template <typename... Args>
+E *HeapEdgeAllocator<E>::create(Args &&...args)
+{
+    E *edge = new E(std::forward<Args>(args)...);
+    this->edges.insert(edge);
+    return edge;
+}
+
+/// @brief Deletes an edge created by this allocator
+/// @param edge An edge owned by the allocator
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+void HeapEdgeAllocator<E>::destroy(E *edge)
+{
+    this->edges.erase(edge);
+    delete edge;
+}
+
+/// @brief Returns whether an edge was created by this allocator
+/// @param edge An edge
+/// @returns Whether the edge is owned by the allocator
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+bool HeapEdgeAllocator<E>::owns(const E *edge) const
+{
+    return this->edges.find(edge) != this->edges.end();
+}
+
+/// @brief Deletes every living edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+void HeapEdgeAllocator<E>::clear()
+{
+    for (const E *edge : this->edges)
+    {
+        delete edge;
+    }
+    this->edges.clear();
+}
+
+/// @brief Makes sure an amount of edges can be tracked without rehashing
+/// @param nbEdges The amount of edges about to be created
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+void HeapEdgeAllocator<E>::reserve(size_t nbEdges)
+{
+    this->edges.reserve(this->edges.size() + nbEdges);
+}
+
+/// @brief Returns the amount of living edges
+/// @returns The amount of edges
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+size_t HeapEdgeAllocator<E>::getNbEdges() const
+{
+    return this->edges.size();
+}
+
+/// @brief Returns an estimate of the bytes allocated by the allocator
+/// @returns The size of the living edges and of the set tracking them
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+size_t HeapEdgeAllocator<E>::memoryUsage() const
+{
+    return this->edges.size() * sizeof(E) + hashMemoryUsage(this->edges);
+}
+
+/// @brief Exchanges the edges of two allocators
+/// @param other The other allocator
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename E>
+void HeapEdgeAllocator<E>::swap(HeapEdgeAllocator &other) noexcept
+{
+    this->edges.swap(other.edges);
+}
+
+#endif // EDGE_ALLOCATOR_H
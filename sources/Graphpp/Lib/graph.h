@@ -4,42 +4,174 @@
 #include <list>
 #include <queue>
 #include <unordered_map>
+#include <unordered_set>
 #include <cmath>
+#include <climits>
+#include <limits>
 #include <stack>
 #include <algorithm>
 #include <sstream>
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <atomic>
+#include <chrono>
+#include "adjacency_list.h"
+#include "connected_components.h"
+#include "direction.h"
 #include "edge.h"
+#include "edge_allocator.h"
+#include "memory_usage.h"
 #include "queue_element.h"
+#include "shortest_paths.h"
+#include "snapshot_epoch.h"
+#include "compact_graph.h"
+#include "hamiltonian_search.h"
+#include "held_karp.h"
+
+/// @brief Degree statistics of a graph, see Graph::getDegreeStatistics()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+struct DegreeStatistics
+{
+    int minIndegree = 0;
+    int maxIndegree = 0;
+    int minOutdegree = 0;
+    int maxOutdegree = 0;
+    /// @brief The amount of vertices whose indegree differs from their outdegree
+    int nbUnbalancedVertices = 0;
+};
+
+/// @brief Whether a graph can be walked through using each of its edges exactly once, see Graph::getEulerianKind()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+enum class EulerianKind
+{
+    /// @brief No walk uses every edge exactly once
+    None,
+    /// @brief A walk uses every edge exactly once, but ends on another vertex than the one it starts from
+    Path,
+    /// @brief A closed walk uses every edge exactly once
+    Circuit
+};
 
 /// @brief Represents a mathematical graph and allows to handle the creation, modification and analysis of it.
 /// @author The Graph++ Development Team
 /// @date spring 2023
-template <typename T> class Graph
+///
+/// The edges created by the graph are allocated by its EdgeAllocator (see edge_allocator.h), which by default
+/// groups them in slabs released all at once when the graph is destroyed or cleared.
+/// Prebuilt edges remain owned by whoever created them.
+///
+/// W is the type of the weights of the edges. With W = void, the edges store no weight at all (see WeightTraits) :
+/// every weight is 1, and the shortest path and spanning tree algorithms become breadth-first searches.
+///
+/// Direction is Directed or Undirected (see direction.h). A directed graph stores each direction as a separate edge
+/// and finds out whether it is oriented from its contents. An undirected graph stores each edge once, in the list of the vertex
+/// it was added from, and reaches it from its other end through the incoming edge index, which is always enabled :
+/// forEachNeighbour() visits both, so no reverse edge ever has to be looked up.
+///
+/// Edges know their source vertex, so removing an edge only visits the lists of its end vertices.
+/// In a directed graph, the two edges created by the graph between the same vertices in opposite directions
+/// are linked as twins (see Edge::getTwin()), so the reverse of an edge is known without any lookup.
+///
+/// A graph owns its vertices, which are deleted with it, by clear() and by removeVertex(), and the edges it created,
+/// which its EdgeAllocator releases. Prebuilt edges remain owned by whoever created them.
+/// A snapshot (see snapshot()) shares the vertices of its graph without owning them, so that another thread can analyse it
+/// while the graph is modified : the graph defers deleting its removed vertices until the snapshots are gone.
+/// As two graphs cannot own the same vertices, a graph cannot be copied : it is moved in O(1), without any vertex
+/// or edge moving in memory, or deep-copied with clone(). A subgraph (see getSubgraph()) shares the vertices and edges
+/// of its graph without owning them : it can be deleted on its own, but must not outlive its graph.
+///
+/// The path and tree algorithms return plain values (edge vectors, ShortestPaths) which do not own anything,
+/// getSubgraph() turning them into a new graph when one is really needed.
+///
+/// Every modifier increments the version of the graph. Structural properties (orientation, weightedness, indegrees
+/// and degree statistics) are computed together in one pass over the edges and cached until the version changes,
+/// while the amount of edges is kept up to date by the modifiers.
+template <typename T, typename W = int, typename Direction = Directed, typename EdgeAllocator = EdgePool<Edge<T, W>>> class Graph
 {
 public:
     Graph();
+    Graph(const Graph &) = delete;
+    Graph &operator=(const Graph &) = delete;
+    Graph(Graph &&other) noexcept;
+    Graph &operator=(Graph &&other) noexcept;
     ~Graph();
 
+    /// @brief Value used for an absent vertex id
+    static constexpr uint32_t NO_VERTEX = UINT32_MAX;
+
+    /// @brief The type used to pass and compute weights, int for unweighted graphs whose weights are all 1
+    typedef typename WeightTraits<W>::type Weight;
+    /// @brief The contiguous container of the outgoing edges of a vertex
+    typedef AdjacencyList<Edge<T, W>> EdgeList;
+    /// @brief The type of the adjacency list
+    typedef std::unordered_map<T *, EdgeList> AdjacencyMap;
+
     // -- attributes --
     /// @brief Represents a graph as an adjacency list
-    std::unordered_map<T *, std::list<Edge<T> *>> adjacencyList;
+    ///
+    /// When this map is modified directly instead of through the modifiers, rebuildIndexes() must be called afterwards.
+    AdjacencyMap adjacencyList;
 
     // -- modifiers --
+    void clear();
+    void swap(Graph &other) noexcept;
+    Graph clone();
+    std::shared_ptr<Graph> snapshot();
     void addVertex(T *vertex);
-    void addEdge(T *source, T *target, int weight = 1);
-    void addDoubleEdge(T *vertex1, T *vertex2, int weight = 1);
-    void addPrebuiltEdge(T *source, Edge<T> *);
+    void addEdge(T *source, T *target, Weight weight = 1);
+    void addDoubleEdge(T *vertex1, T *vertex2, Weight weight = 1);
+    void addPrebuiltEdge(T *source, Edge<T, W> *);
+    template <typename VertexRange>
+    void addVertices(const VertexRange &vertices);
+    template <typename EdgeRange>
+    void addEdges(const EdgeRange &edges);
     void removeVertex(T *vertex);
-    std::list<Edge<T>*> popVertex(T *vertex);
-    void removeEdge(Edge<T> *edge);
-    void popEdge(Edge<T> *edge);
+    std::list<Edge<T, W>*> popVertex(T *vertex);
+    void removeEdge(Edge<T, W> *edge);
+    void popEdge(Edge<T, W> *edge);
+    template <typename VertexRange>
+    void removeVertices(const VertexRange &vertices);
+    template <typename VertexRange>
+    std::list<Edge<T, W>*> popVertices(const VertexRange &vertices);
+    template <typename EdgeRange>
+    void removeEdges(const EdgeRange &edges);
+    template <typename EdgeRange>
+    std::list<Edge<T, W>*> popEdges(const EdgeRange &edges);
+    void setEdgeWeight(Edge<T, W> *edge, Weight weight);
+    void rebuildIndexes();
+    void setIncomingEdgeIndex(bool enabled);
+    bool hasIncomingEdgeIndex();
+    void setEdgeIndex(bool enabled);
+    bool hasEdgeIndex();
+
+    // -- vertex ids --
+    uint32_t getVertexId(T *vertex);
+    T *getVertex(uint32_t id);
+    uint32_t getVertexIdBound();
+    uint32_t getTargetId(Edge<T, W> *edge);
+    EdgeList &getEdges(uint32_t id);
+    const std::vector<std::pair<uint32_t, Edge<T, W> *>> &getIncomingEdges(uint32_t id);
+    Edge<T, W> *findEdge(T *source, T *target);
+    Edge<T, W> *findEdge(uint32_t sourceId, uint32_t targetId);
+    template <typename Visitor>
+    void forEachNeighbour(uint32_t id, Visitor visit);
 
     // -- analysis --
+    uint64_t getVersion();
     bool isEmpty();
     bool isEulerian();
+    EulerianKind getEulerianKind();
     bool isHamiltonian();
+    HamiltonianStatus getHamiltonianStatus(std::chrono::milliseconds timeLimit, const std::atomic<bool> *cancelled = nullptr);
     bool isConnected();
     bool isStronglyConnected();
+    ConnectedComponents getConnectedComponents();
+    StronglyConnectedComponents getStronglyConnectedComponents();
 
     bool isOriented();
     bool isWeighted();
@@ -47,12 +179,29 @@ public:
     int getNbEdges();
     int getNbVertices();
     int getVertexIndegree(T *vertex);
+    int getVertexIndegree(uint32_t id);
     int getVertexOutdegree(T *vertex);
-
-    // Paths, cycles, trees, subgraphs
-    Graph<T> *getMinimumSpanningTree();
-    Graph<T> *getMinimumDistanceGraph(T *startingVertex);
-    Graph<T> *getHamiltonianPath();
+    int getVertexOutdegree(uint32_t id);
+    DegreeStatistics getDegreeStatistics();
+    MemoryUsage memoryUsage();
+
+    // Paths, cycles, trees
+    std::vector<Edge<T, W> *> getMinimumSpanningTreeEdges();
+    ShortestPaths<T, W> getShortestPaths(T *startingVertex);
+    ShortestPaths<T, W> getShortestPaths(uint32_t startingVertexId);
+    std::vector<Edge<T, W> *> getHamiltonianPathEdges(bool circuit = true, std::chrono::milliseconds timeLimit = std::chrono::milliseconds::zero(),
+                                                      const std::atomic<bool> *cancelled = nullptr, HamiltonianStatus *status = nullptr);
+    std::vector<Edge<T, W> *> getEulerianPath();
+
+    // Subgraphs
+    Graph<T, W, Direction, EdgeAllocator> *getSubgraph(const std::vector<Edge<T, W> *> &edges, bool withReverseEdges = false);
+    Graph<T, W, Direction, EdgeAllocator> *getMinimumSpanningTree();
+    Graph<T, W, Direction, EdgeAllocator> *getMinimumDistanceGraph(T *startingVertex);
+    Graph<T, W, Direction, EdgeAllocator> *getMinimumDistanceGraph(uint32_t startingVertexId);
+    Graph<T, W, Direction, EdgeAllocator> *getHamiltonianPath();
+
+    // Snapshots
+    CompactGraph<T, W> freeze();
 
     // Serialization
     std::string exportToDOT();
@@ -63,37 +212,351 @@ public:
 
     template <typename T2>
     friend std::istream &operator>>(std::istream &is, Graph<T2> &p);
+
+private:
+    /// @brief Maps a vertex id to its vertex, nullptr for the ids of removed vertices
+    std::vector<T *> vertexTable;
+    /// @brief Maps a vertex id to its adjacency list, which lives in adjacencyList
+    std::vector<EdgeList *> adjacencyById;
+    /// @brief Maps a vertex to its id
+    std::unordered_map<T *, uint32_t> vertexIds;
+    /// @brief Ids of the removed vertices, reused by the next added vertices
+    std::vector<uint32_t> freeIds;
+    /// @brief Whether the incoming edges of each vertex are indexed, always the case for undirected graphs
+    bool incomingIndexEnabled = !Direction::directed;
+    /// @brief Maps a vertex id to its incoming edges, as pairs of (source id, edge), when the index is enabled
+    std::vector<std::vector<std::pair<uint32_t, Edge<T, W> *>>> incomingById;
+    /// @brief Whether the edges are indexed by their end vertices
+    bool edgeIndexEnabled = false;
+    /// @brief Maps the ids of the source and target vertices, packed by edgeKey(), to an edge, when the index is enabled
+    std::unordered_map<uint64_t, Edge<T, W> *> edgesByEnds;
+
+    /// @brief Allocates the edges created by the graph
+    EdgeAllocator edgeAllocator;
+
+    /// @brief Incremented by every modification of the graph
+    uint64_t version = 0;
+    /// @brief The amount of edges of the graph, each direction counted separately
+    int nbArcs = 0;
+    /// @brief The structural properties derived from the edges, see refreshProperties()
+    struct Properties
+    {
+        /// @brief The version of the graph the properties were computed for
+        uint64_t version = UINT64_MAX;
+        bool oriented = false;
+        bool weighted = false;
+        /// @brief Maps a vertex id to its indegree
+        std::vector<int> indegrees;
+        DegreeStatistics degreeStatistics;
+    } properties;
+
+    /// @brief Whether the graph deletes its vertices, which a snapshot does not
+    bool ownsVertices = true;
+    /// @brief The current epoch, whose retired vertices may be referred to by snapshots, nullptr before the first snapshot
+    std::shared_ptr<SnapshotEpoch<T>> epoch;
+
+    template <typename VertexCopier>
+    void copyStructureTo(Graph &copy, VertexCopier copyVertex);
+    void retireVertex(T *vertex);
+    void reclaimVertices();
+    void destroyEdge(Edge<T, W> *edge);
+    void markModified();
+    void refreshProperties();
+    void assignVertexId(T *vertex, EdgeList *edges);
+    void releaseVertexId(T *vertex);
+    void indexIncomingEdge(uint32_t sourceId, Edge<T, W> *edge);
+    void unindexIncomingEdge(Edge<T, W> *edge);
+    static uint64_t edgeKey(uint32_t sourceId, uint32_t targetId);
+    void indexEdge(uint32_t sourceId, Edge<T, W> *edge);
+    void unindexEdge(uint32_t sourceId, Edge<T, W> *edge);
+    void linkTwins(const std::vector<std::pair<uint32_t, Edge<T, W> *>> &candidates);
+    void unlinkTwin(Edge<T, W> *edge);
+    Edge<T, W> *getReverseEdge(uint32_t sourceId, Edge<T, W> *edge);
 };
 
 /// @brief Initializes a new graph
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T>
-Graph<T>::Graph()
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator>::Graph()
+{
+    this->adjacencyList = AdjacencyMap();
+}
+
+/// @brief Takes over the vertices and edges of another graph, which is left empty
+/// @param other The graph to move from
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// O(1) : the containers are exchanged, no vertex or edge moves in memory, so every pointer to them stays valid.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator>::Graph(Graph &&other) noexcept
+    : Graph()
+{
+    this->swap(other);
+}
+
+/// @brief Deletes the vertices and edges of the graph, then takes over the ones of another graph, which is left empty
+/// @param other The graph to move from
+/// @returns This graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator> &Graph<T, W, Direction, EdgeAllocator>::operator=(Graph &&other) noexcept
 {
-    this->adjacencyList = std::unordered_map<T *, std::list<Edge<T> *>>();
+    if (this != &other)
+    {
+        this->clear();
+        this->swap(other);
+    }
+    return *this;
 }
 
 /// @brief Deletes the current graph AND ALL THE VERTICES/EDGES CONTAINED
 /// @author Jonas Flückiger
 /// @date 16.05.2023
-template <typename T>
-Graph<T>::~Graph()
+///
+/// The edges created by the graph, including the ones popped out of it, are released all at once.
+/// Prebuilt edges are left to their owner.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator>::~Graph()
+{
+    for(auto const &pair : this->adjacencyList){
+        this->retireVertex(pair.first);
+    }
+}
+
+/// @brief Removes and deletes all the vertices and edges of the graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The edges created by the graph, including the ones popped out of it, are released all at once.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::clear()
+{
+    for (auto const &vertexPair : this->adjacencyList)
+    {
+        this->retireVertex(vertexPair.first);
+    }
+    this->adjacencyList.clear();
+    this->edgeAllocator.clear();
+    this->rebuildIndexes();
+}
+
+/// @brief Exchanges the vertices, edges, indexes and settings of two graphs in O(1)
+/// @param other The other graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Both graphs get a new version, higher than their previous ones, so that anyone who recorded the version
+/// of either graph sees it modified. The cached properties follow the contents they were computed for.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::swap(Graph &other) noexcept
+{
+    this->adjacencyList.swap(other.adjacencyList);
+    this->vertexTable.swap(other.vertexTable);
+    this->adjacencyById.swap(other.adjacencyById);
+    this->vertexIds.swap(other.vertexIds);
+    this->freeIds.swap(other.freeIds);
+    std::swap(this->incomingIndexEnabled, other.incomingIndexEnabled);
+    this->incomingById.swap(other.incomingById);
+    std::swap(this->edgeIndexEnabled, other.edgeIndexEnabled);
+    this->edgesByEnds.swap(other.edgesByEnds);
+    this->edgeAllocator.swap(other.edgeAllocator);
+    std::swap(this->nbArcs, other.nbArcs);
+    std::swap(this->properties, other.properties);
+    std::swap(this->version, other.version);
+    std::swap(this->ownsVertices, other.ownsVertices);
+    this->epoch.swap(other.epoch);
+
+    uint64_t version = std::max(this->version, other.version) + 1;
+    for (Graph *graph : {this, &other})
+    {
+        if (graph->properties.version == graph->version)
+        {
+            graph->properties.version = version;
+        }
+        graph->version = version;
+    }
+}
+
+/// @brief Returns a deep copy of the graph
+/// @returns A new graph owning copies of the vertices and edges of this graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Each vertex is copied with the copy constructor of T, and each edge, prebuilt or not, becomes an edge created by the copy,
+/// in the same order. The indexes are enabled as in this graph, but the vertex ids may differ. O(V + E).
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator> Graph<T, W, Direction, EdgeAllocator>::clone()
+{
+    Graph<T, W, Direction, EdgeAllocator> copy;
+    this->copyStructureTo(copy, [](T *vertex) { return new T(*vertex); });
+    return copy;
+}
+
+/// @brief Returns a snapshot of the graph, which another thread can analyse while this graph is modified
+/// @returns A new graph with the same vertices, and its own copy of the edges
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The snapshot shares the vertices of this graph without owning them, and owns copies of the edges, so the two graphs
+/// share no mutable state : the vertices are only used as keys by the analysis. While a snapshot is alive, the vertices
+/// removed from this graph are retired instead of deleted (see SnapshotEpoch), so the snapshot never refers to a deleted vertex.
+/// The snapshot must be treated as read-only and analysed by one thread at a time, each call building a separate one.
+///
+/// Each call copies every edge and rebuilds the indexes of the copy, O(V + E) in time and memory, as much as clone()
+/// without the vertices. On a large graph, a thread which must stay responsive should leave the call to the analysing thread.
+/// Every modification of the graph and every call to snapshot() must then hold the same lock (SharedGraph::mutex in the App) :
+/// the graph must not be modified during the copy, and reclaimVertices() must not run while a snapshot is being taken.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+std::shared_ptr<Graph<T, W, Direction, EdgeAllocator>> Graph<T, W, Direction, EdgeAllocator>::snapshot()
+{
+    if (this->epoch == nullptr)
+    {
+        this->epoch = std::make_shared<SnapshotEpoch<T>>();
+    }
+    this->reclaimVertices();
+
+    std::shared_ptr<Graph<T, W, Direction, EdgeAllocator>> copy = std::make_shared<Graph<T, W, Direction, EdgeAllocator>>();
+    this->copyStructureTo(*copy, [](T *vertex) { return vertex; });
+    copy->ownsVertices = false;
+    copy->epoch = this->epoch;
+
+    // The vertices removed from now on may be referred to by the snapshot
+    this->epoch->next = std::make_shared<SnapshotEpoch<T>>();
+    this->epoch = this->epoch->next;
+    return copy;
+}
+
+/// @brief Fills an empty graph with the vertices and edges of this graph
+/// @param copy An empty graph
+/// @param copyVertex Returns the vertex of the copy corresponding to a vertex of this graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Each edge, prebuilt or not, becomes an edge created by the copy, in the same order.
+/// The indexes are enabled as in this graph, but the vertex ids may differ. O(V + E).
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+template <typename VertexCopier>
+void Graph<T, W, Direction, EdgeAllocator>::copyStructureTo(Graph &copy, VertexCopier copyVertex)
+{
+    copy.incomingIndexEnabled = this->incomingIndexEnabled;
+    copy.edgeIndexEnabled = this->edgeIndexEnabled;
+    copy.adjacencyList.reserve(this->adjacencyList.size());
+    copy.edgeAllocator.reserve(this->nbArcs);
+
+    std::unordered_map<T *, T *> copies;
+    copies.reserve(this->adjacencyList.size());
+    for (auto const &vertexPair : this->adjacencyList)
+    {
+        copies[vertexPair.first] = copyVertex(vertexPair.first);
+    }
+    for (auto const &vertexPair : this->adjacencyList)
+    {
+        EdgeList &edges = copy.adjacencyList[copies[vertexPair.first]];
+        edges.reserve(vertexPair.second.size());
+        for (Edge<T, W> *edge : vertexPair.second)
+        {
+            auto target = copies.find(edge->getTarget());
+            if (target != copies.end())
+            {
+                edges.push_back(copy.edgeAllocator.create(target->second, edge->getWeight()));
+            }
+        }
+    }
+
+    // Sets the sources, twins, ids and indexes of the copy
+    copy.rebuildIndexes();
+}
+
+/// @brief Deletes a vertex removed from the graph, unless a snapshot may still refer to it
+/// @param vertex A vertex, already removed from the graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The vertex is retired into the current epoch when an older one is still alive, see SnapshotEpoch.
+/// The vertices of a snapshot belong to the graph it was taken from, so a snapshot never deletes them.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::retireVertex(T *vertex)
+{
+    if (!this->ownsVertices)
+    {
+        return;
+    }
+    this->reclaimVertices();
+    if (this->epoch != nullptr && this->epoch.use_count() > 1)
+    {
+        this->epoch->retired.push_back(vertex);
+    }
+    else
+    {
+        delete vertex;
+    }
+}
+
+/// @brief Deletes the retired vertices once no snapshot may refer to them anymore
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The current epoch is only shared with the older epochs, which are released with the snapshots :
+/// when the graph is its only owner, every snapshot taken before the retired vertices were removed is gone.
+/// Its count of owners only grows in snapshot(), which may run on another thread, so a count of 1 is reliable only if
+/// every modification of the graph and every call to snapshot() hold the same lock (SharedGraph::mutex in the App).
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::reclaimVertices()
 {
-    for(auto pair : this->adjacencyList){
-        for(auto edge : this->adjacencyList[pair.first]){
-            delete edge;
+    if (this->epoch != nullptr && this->epoch.use_count() == 1)
+    {
+        for (T *vertex : this->epoch->retired)
+        {
+            delete vertex;
         }
-        delete pair.first;
+        this->epoch->retired.clear();
+    }
+}
+
+/// @brief Deletes an edge if it was created by this graph
+/// @param edge An edge, already removed from the graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::destroyEdge(Edge<T, W> *edge)
+{
+    if (this->edgeAllocator.owns(edge))
+    {
+        this->edgeAllocator.destroy(edge);
     }
 }
 
+/// @brief Records a modification of the graph, which invalidates the cached properties
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::markModified()
+{
+    this->version++;
+}
+
+/// @brief Returns the version of the graph
+/// @returns A number incremented by every modification of the graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Two calls returning the same version mean that the graph was not modified in between,
+/// so the results computed on it in between are still valid.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+uint64_t Graph<T, W, Direction, EdgeAllocator>::getVersion()
+{
+    return this->version;
+}
+
 /// @brief Returns whether the graph is empty
 /// @returns Whether the graph is empty
 /// @author Damien Tschan
 /// @date 05.06.2023
-template <typename T>
-bool Graph<T>::isEmpty()
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::isEmpty()
 {
     return this->adjacencyList.size() == 0;
 }
@@ -102,12 +565,14 @@ bool Graph<T>::isEmpty()
 /// @param vertex A vertex
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T>
-void Graph<T>::addVertex(T *vertex)
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::addVertex(T *vertex)
 {
     if (this->adjacencyList.find(vertex) == this->adjacencyList.end())
     {
-        this->adjacencyList.insert(std::make_pair(vertex, std::list<Edge<T> *>()));
+        auto inserted = this->adjacencyList.insert(std::make_pair(vertex, EdgeList()));
+        this->assignVertexId(vertex, &inserted.first->second);
+        this->markModified();
     }
     else
     {
@@ -122,26 +587,34 @@ void Graph<T>::addVertex(T *vertex)
 /// @param weight The weight of the edge
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T>
-void Graph<T>::addEdge(T *source, T *target, int weight)
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::addEdge(T *source, T *target, Weight weight)
 {
-    if (this->adjacencyList.find(source) != this->adjacencyList.end())
+    uint32_t sourceId = this->getVertexId(source);
+    if (sourceId != NO_VERTEX)
     {
-        if (this->adjacencyList.find(target) != this->adjacencyList.end())
+        uint32_t targetId = this->getVertexId(target);
+        if (targetId != NO_VERTEX)
         {
-            std::list<Edge<T>*> existingEdges = this->adjacencyList[source];
-            bool edgeAlreadyExists = false;
-            for(Edge<T>* existingEdge : existingEdges)
+            if(this->findEdge(sourceId, targetId) == nullptr)
             {
-                if(existingEdge->getTarget() == target)
+                Edge<T, W> *newEdge = this->edgeAllocator.create(target, weight);
+                newEdge->source = source;
+                newEdge->targetIdHint = targetId;
+                this->getEdges(sourceId).push_back(newEdge);
+                this->indexIncomingEdge(sourceId, newEdge);
+                this->indexEdge(sourceId, newEdge);
+                if constexpr (Direction::directed)
                 {
-                    edgeAlreadyExists = true;
+                    Edge<T, W> *reverseEdge = this->findEdge(targetId, sourceId);
+                    if (reverseEdge != nullptr && reverseEdge != newEdge && reverseEdge->twin == nullptr && this->edgeAllocator.owns(reverseEdge))
+                    {
+                        newEdge->twin = reverseEdge;
+                        reverseEdge->twin = newEdge;
+                    }
                 }
-            }
-            if(!edgeAlreadyExists)
-            {
-                Edge<T> *newEdge = new Edge(target, weight);
-                this->adjacencyList[source].push_back(newEdge);
+                this->nbArcs++;
+                this->markModified();
             }
         }
         else
@@ -161,8 +634,8 @@ void Graph<T>::addEdge(T *source, T *target, int weight)
 /// @param weight The weight of the edge
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T>
-void Graph<T>::addDoubleEdge(T *vertex1, T *vertex2, int weight)
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::addDoubleEdge(T *vertex1, T *vertex2, Weight weight)
 {
     this->addEdge(vertex1, vertex2, weight);
     this->addEdge(vertex2, vertex1, weight);
@@ -173,28 +646,200 @@ void Graph<T>::addDoubleEdge(T *vertex1, T *vertex2, int weight)
 /// @param The prebuilt edge
 /// @author Jonas Flückiger
 /// @date 15.05.2023
-template <typename T>
-void Graph<T>::addPrebuiltEdge(T *source, Edge<T> *edge)
+///
+/// The edge keeps the source it was first added with, so a prebuilt edge shared by several graphs must have the same source in all of them.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::addPrebuiltEdge(T *source, Edge<T, W> *edge)
+{
+    if (edge->source == nullptr)
+    {
+        edge->source = source;
+    }
+    if (this->getVertexId(source) == NO_VERTEX)
+    {
+        this->addVertex(source);
+    }
+    uint32_t sourceId = this->getVertexId(source);
+    this->getEdges(sourceId).push_back(edge);
+    this->indexIncomingEdge(sourceId, edge);
+    this->indexEdge(sourceId, edge);
+    this->nbArcs++;
+    this->markModified();
+}
+
+/// @brief Adds many vertices to the graph at once
+/// @param vertices A range of vertices, e.g. a std::vector<T *> or an array
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Same as calling addVertex() for each vertex, but the internal tables are sized once for the whole batch.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+template <typename VertexRange>
+void Graph<T, W, Direction, EdgeAllocator>::addVertices(const VertexRange &vertices)
+{
+    size_t nbVertices = this->adjacencyList.size() + std::distance(std::begin(vertices), std::end(vertices));
+    this->adjacencyList.reserve(nbVertices);
+    this->vertexIds.reserve(nbVertices);
+    this->vertexTable.reserve(nbVertices);
+    this->adjacencyById.reserve(nbVertices);
+    if (this->incomingIndexEnabled)
+    {
+        this->incomingById.reserve(nbVertices);
+    }
+    for (T *vertex : vertices)
+    {
+        this->addVertex(vertex);
+    }
+}
+
+/// @brief Adds many edges to the graph at once
+/// @param edges A range of (source, target, weight) tuples, e.g. a std::vector<std::tuple<T *, T *, int>>.
+/// Pairs of (source, target) are accepted as well, their weight is 1.
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Same result as calling addEdge() for each edge : edges between unknown vertices are ignored,
+/// as well as the edges already in the graph and the duplicates of the batch, of which the first one is kept.
+///
+/// The batch is bucketed by source with a counting sort, then each adjacency list is reserved once and appended to,
+/// duplicates being detected with a per-target stamp. This costs O(V + E) instead of one lookup and one scan per edge.
+/// On an undirected graph, an edge is also a duplicate of the edges in the opposite direction.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+template <typename EdgeRange>
+void Graph<T, W, Direction, EdgeAllocator>::addEdges(const EdgeRange &edges)
 {
-    this->adjacencyList[source].push_back(edge);
+    struct PendingEdge
+    {
+        uint32_t sourceId;
+        uint32_t targetId;
+        Weight weight;
+    };
+
+    // Resolve the vertex ids of the batch
+    std::vector<PendingEdge> pending;
+    pending.reserve(std::distance(std::begin(edges), std::end(edges)));
+    for (auto const &edge : edges)
+    {
+        PendingEdge pendingEdge;
+        pendingEdge.sourceId = this->getVertexId(std::get<0>(edge));
+        pendingEdge.targetId = this->getVertexId(std::get<1>(edge));
+        pendingEdge.weight = 1;
+        if constexpr (std::tuple_size<typename std::decay<decltype(edge)>::type>::value > 2)
+        {
+            pendingEdge.weight = std::get<2>(edge);
+        }
+        if (pendingEdge.sourceId != NO_VERTEX && pendingEdge.targetId != NO_VERTEX)
+        {
+            pending.push_back(pendingEdge);
+        }
+    }
+
+    // Bucket the batch by source, keeping the order of the batch within each bucket
+    // On an undirected graph, the bucket is the end of lowest id, so that both directions of an edge meet in the same bucket
+    auto bucketOf = [](PendingEdge const &pendingEdge)
+    {
+        return Direction::directed ? pendingEdge.sourceId : std::min(pendingEdge.sourceId, pendingEdge.targetId);
+    };
+    uint32_t bound = this->getVertexIdBound();
+    std::vector<uint32_t> offsets(bound + 1, 0);
+    for (PendingEdge const &pendingEdge : pending)
+    {
+        offsets[bucketOf(pendingEdge) + 1]++;
+    }
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        offsets[id + 1] += offsets[id];
+    }
+    std::vector<PendingEdge> sorted(pending.size());
+    {
+        std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+        for (PendingEdge const &pendingEdge : pending)
+        {
+            sorted[next[bucketOf(pendingEdge)]++] = pendingEdge;
+        }
+    }
+    pending = std::vector<PendingEdge>();
+
+    this->edgeAllocator.reserve(sorted.size());
+    if (this->edgeIndexEnabled)
+    {
+        this->edgesByEnds.reserve(this->edgesByEnds.size() + sorted.size());
+    }
+
+    // Append each bucket, skipping the targets the source already reaches
+    std::vector<uint32_t> stamps(bound, NO_VERTEX);
+    std::vector<std::pair<uint32_t, Edge<T, W> *>> created;
+    if (Direction::directed)
+    {
+        created.reserve(sorted.size());
+    }
+    for (uint32_t sourceId = 0; sourceId < bound; sourceId++)
+    {
+        if (offsets[sourceId] == offsets[sourceId + 1])
+        {
+            continue;
+        }
+        EdgeList &sourceEdges = this->getEdges(sourceId);
+        for (Edge<T, W> *edge : sourceEdges)
+        {
+            uint32_t targetId = this->getTargetId(edge);
+            if (targetId != NO_VERTEX)
+            {
+                stamps[targetId] = sourceId;
+            }
+        }
+        if constexpr (!Direction::directed)
+        {
+            for (auto const &incomingEdge : this->incomingById[sourceId])
+            {
+                stamps[incomingEdge.first] = sourceId;
+            }
+        }
+        if (Direction::directed)
+        {
+            sourceEdges.reserve(sourceEdges.size() + offsets[sourceId + 1] - offsets[sourceId]);
+        }
+        for (uint32_t i = offsets[sourceId]; i < offsets[sourceId + 1]; i++)
+        {
+            PendingEdge const &pendingEdge = sorted[i];
+            uint32_t otherId = pendingEdge.sourceId == sourceId ? pendingEdge.targetId : pendingEdge.sourceId;
+            if (stamps[otherId] != sourceId)
+            {
+                stamps[otherId] = sourceId;
+                Edge<T, W> *newEdge = this->edgeAllocator.create(this->getVertex(pendingEdge.targetId), pendingEdge.weight);
+                newEdge->source = this->getVertex(pendingEdge.sourceId);
+                newEdge->targetIdHint = pendingEdge.targetId;
+                if (Direction::directed)
+                {
+                    created.push_back(std::make_pair(pendingEdge.sourceId, newEdge));
+                }
+                this->getEdges(pendingEdge.sourceId).push_back(newEdge);
+                this->indexIncomingEdge(pendingEdge.sourceId, newEdge);
+                this->indexEdge(pendingEdge.sourceId, newEdge);
+                this->nbArcs++;
+            }
+        }
+    }
+    this->linkTwins(created);
+    this->markModified();
 }
 
 /// @brief Removes a vertex and its linked edges from the graph and deletes them
 /// @param vertex A vertex
 /// @author Damien Tschan
 /// @date 01.06.2023
-template <typename T>
-void Graph<T>::removeVertex(T *vertex)
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::removeVertex(T *vertex)
 {
     // Remove all edges related to the vertex
-    std::list<Edge<T>*> poppedEdges = popVertex(vertex);
+    std::list<Edge<T, W>*> poppedEdges = popVertex(vertex);
     for(auto *edge : poppedEdges)
     {
-        delete edge;
+        this->destroyEdge(edge);
     }
 
     // Remove the vertex from the map
-    delete vertex;
+    this->retireVertex(vertex);
 }
 
 /// @brief Removes a vertex and its linked edges from the graph but doesn't delete anything
@@ -204,45 +849,86 @@ void Graph<T>::removeVertex(T *vertex)
 /// @return a list of all removed edges (removed from the graph but not deleted)
 ///
 /// As the targeted vertex is a parameter of the function, it doesn't need to be returned (the caller already knows it)
-template <typename T>
-std::list<Edge<T>*> Graph<T>::popVertex(T *vertex)
+///
+/// With the incoming edge index, only the lists of the neighbouring vertices are visited,
+/// otherwise every adjacency list of the graph is scanned.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+std::list<Edge<T, W>*> Graph<T, W, Direction, EdgeAllocator>::popVertex(T *vertex)
 {
-    std::list<Edge<T>*> poppedEdges;
+    std::list<Edge<T, W>*> poppedEdges;
+    uint32_t id = this->getVertexId(vertex);
+    if (id == NO_VERTEX)
+    {
+        return poppedEdges;
+    }
 
     // Remove all edges targeting the vertex
-    for (auto &vertexPair : this->adjacencyList)
+    if (this->incomingIndexEnabled)
     {
-        auto &edgeList = vertexPair.second;
-        auto edgeIt = edgeList.begin();
-        while (edgeIt != edgeList.end())
+        for (auto const &incomingEdge : this->incomingById[id])
         {
-            if ((*edgeIt)->getTarget() == vertex)
+            if (incomingEdge.first == id)
             {
-                poppedEdges.push_back(*edgeIt);
-                edgeIt = edgeList.erase(edgeIt);
+                continue; // loops are removed with the edges sourcing from the vertex
             }
-            else
+            this->getEdges(incomingEdge.first).remove(incomingEdge.second);
+            this->unindexEdge(incomingEdge.first, incomingEdge.second);
+            poppedEdges.push_back(incomingEdge.second);
+        }
+        this->incomingById[id].clear();
+    }
+    else
+    {
+        for (auto &vertexPair : this->adjacencyList)
+        {
+            if (vertexPair.first == vertex)
+            {
+                continue; // loops are removed with the edges sourcing from the vertex
+            }
+            auto &edgeList = vertexPair.second;
+            auto edgeIt = edgeList.begin();
+            while (edgeIt != edgeList.end())
             {
-                ++edgeIt;
+                if ((*edgeIt)->getTarget() == vertex)
+                {
+                    Edge<T, W> *edge = *edgeIt;
+                    poppedEdges.push_back(edge);
+                    edgeIt = edgeList.erase(edgeIt);
+                    this->unindexEdge(this->getVertexId(vertexPair.first), edge);
+                }
+                else
+                {
+                    ++edgeIt;
+                }
             }
         }
     }
 
     // Remove all edges sourcing from the vertex
-    /*
-    auto &edgeList = this->adjacencyList[vertex];
-    auto edgeIt = edgeList.begin();
-    while (edgeIt != edgeList.end())
+    for (Edge<T, W> *edge : this->getEdges(id))
     {
-        poppedEdges.push_back(*edgeIt);
-        this->adjacencyList[vertex].erase(edgeIt);
-        ++edgeIt;
-    }*/
+        if (edge->getTarget() != vertex)
+        {
+            this->unindexIncomingEdge(edge);
+        }
+        if (this->edgeIndexEnabled)
+        {
+            this->edgesByEnds.erase(edgeKey(id, this->getTargetId(edge)));
+        }
+        poppedEdges.push_back(edge);
+    }
+    this->getEdges(id).clear();
 
-    this->adjacencyList[vertex].clear();
+    for (Edge<T, W> *edge : poppedEdges)
+    {
+        this->unlinkTwin(edge);
+    }
 
     // Remove the vertex from the map
+    this->releaseVertexId(vertex);
     adjacencyList.erase(vertex);
+    this->nbArcs -= poppedEdges.size();
+    this->markModified();
 
     return poppedEdges;
 }
@@ -251,11 +937,11 @@ std::list<Edge<T>*> Graph<T>::popVertex(T *vertex)
 /// @param edge An edge
 /// @author Damien Tschan
 /// @date 01.06.2023
-template <typename T>
-void Graph<T>::removeEdge(Edge<T> *edge)
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::removeEdge(Edge<T, W> *edge)
 {
     popEdge(edge);
-    delete edge;
+    this->destroyEdge(edge);
     edge = nullptr;
 }
 
@@ -265,9 +951,54 @@ void Graph<T>::removeEdge(Edge<T> *edge)
 /// @date 01.06.2023
 ///
 /// As the targeted edge is a parameter of the function, it doesn't need to be returned (the caller already knows it)
-template <typename T>
-void Graph<T>::popEdge(Edge<T> *edge)
+///
+/// The edge is looked for in the adjacency list of its source, and in the incoming edges of its target if they are indexed,
+/// so removing an edge costs O(deg) instead of a pass over the whole graph.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::popEdge(Edge<T, W> *edge)
 {
+    uint32_t ownerId = this->getVertexId(edge->getSource());
+    if (ownerId != NO_VERTEX)
+    {
+        EdgeList &ownerEdges = this->getEdges(ownerId);
+        auto it = std::find(ownerEdges.begin(), ownerEdges.end(), edge);
+        if (it != ownerEdges.end())
+        {
+            ownerEdges.erase(it);
+            this->unindexIncomingEdge(edge);
+            this->unindexEdge(ownerId, edge);
+            this->unlinkTwin(edge);
+            this->nbArcs--;
+            this->markModified();
+            return;
+        }
+    }
+
+    // The edge is not in the list of its source, which happens for a prebuilt edge shared with graphs where its source differs
+    // With the incoming edge index, the source of the edge is known without scanning the graph
+    if (this->incomingIndexEnabled)
+    {
+        uint32_t targetId = this->getTargetId(edge);
+        if (targetId != NO_VERTEX)
+        {
+            for (auto const &incomingEdge : this->incomingById[targetId])
+            {
+                if (incomingEdge.second == edge)
+                {
+                    uint32_t sourceId = incomingEdge.first;
+                    this->getEdges(sourceId).remove(edge);
+                    this->unindexIncomingEdge(edge);
+                    this->unindexEdge(sourceId, edge);
+                    this->unlinkTwin(edge);
+                    this->nbArcs--;
+                    this->markModified();
+                    return;
+                }
+            }
+        }
+        return;
+    }
+
     for (auto &vertex : this->adjacencyList)
     {
         auto it = vertex.second.begin();
@@ -276,6 +1007,10 @@ void Graph<T>::popEdge(Edge<T> *edge)
             if (*it == edge)
             {
                 it = vertex.second.erase(it);
+                this->unindexEdge(this->getVertexId(vertex.first), edge);
+                this->unlinkTwin(edge);
+                this->nbArcs--;
+                this->markModified();
             }
             else
             {
@@ -285,599 +1020,1711 @@ void Graph<T>::popEdge(Edge<T> *edge)
     }
 }
 
-/// @brief Returns whether the graph is eulerian
-/// @returns Whether the graph is eulerian
-/// @author Damien Tschan
-/// @date 08.05.2023
-template <typename T>
-bool Graph<T>::isEulerian()
+/// @brief Removes many vertices and their linked edges from the graph at once and deletes them
+/// @param vertices A range of vertices, e.g. a std::vector<T *>
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+template <typename VertexRange>
+void Graph<T, W, Direction, EdgeAllocator>::removeVertices(const VertexRange &vertices)
 {
-    for (auto &vertex : this->adjacencyList)
+    std::vector<T *> removedVertices;
+    std::vector<bool> removed(this->getVertexIdBound(), false);
+    for (T *vertex : vertices)
     {
-        if (this->getVertexIndegree(vertex.first) % 2 != 0 || this->getVertexOutdegree(vertex.first) % 2 != 0)
+        uint32_t id = this->getVertexId(vertex);
+        if (id != NO_VERTEX && !removed[id])
         {
-            return false;
+            removed[id] = true;
+            removedVertices.push_back(vertex);
         }
     }
-    return true && this->isConnected();
-}
-
-/// @brief Returns whether the graph is hamiltonian
-/// @returns Whether the graph is hamiltonian
-/// @author Damien Tschan
-/// @date 05.06.2023
-template <typename T>
-bool Graph<T>::isHamiltonian()
-{
-    //checks if getHamiltonianPath founds a path or not
-    return !getHamiltonianPath()->isEmpty();
+    std::list<Edge<T, W>*> poppedEdges = this->popVertices(removedVertices);
+    for (auto *edge : poppedEdges)
+    {
+        this->destroyEdge(edge);
+    }
+    for (T *vertex : removedVertices)
+    {
+        this->retireVertex(vertex);
+    }
 }
 
-/// @brief Returns the hamiltonian path of a graph
-/// @returns A subgraph containing the hamiltonian path if it exists, an empty graph otherwise
-/// @author Damien Tschan
-/// @date 09.06.2023
-///
-/// Since the algorithm and deduction rules are oriented toward directed graphs, each Edge is counted twice.
-/// To prevent that, when an Edge is added to the partial path, the opposite Edge is deleted.
-/// This means that this method has to be updated to fully support oriented graphs.
+/// @brief Removes many vertices and their linked edges from the graph at once but doesn't delete anything
+/// @param vertices A range of vertices, e.g. a std::vector<T *>
+/// @returns A list of all removed edges (removed from the graph but not deleted)
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
 ///
-/// As not all rules are implemented, it is almost a brute force algorithm, with a complexity of O(n!)
-template <typename T>
-Graph<T>* Graph<T>::getHamiltonianPath()
+/// Same result as calling popVertex() for each vertex, but the removed vertices are marked in a bitmap
+/// and every affected adjacency list is compacted once. This costs O(V + E) at most, instead of one pass per vertex
+/// without the incoming edge index. With the index, only the lists of the neighbours of the removed vertices are visited.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+template <typename VertexRange>
+std::list<Edge<T, W>*> Graph<T, W, Direction, EdgeAllocator>::popVertices(const VertexRange &vertices)
 {
-    if(this->isConnected())
+    std::list<Edge<T, W>*> poppedEdges;
+    uint32_t bound = this->getVertexIdBound();
+    std::vector<bool> removed(bound, false);
+    std::vector<uint32_t> removedIds;
+    for (T *vertex : vertices)
     {
-        std::list<std::pair<T*,Edge<T>*>> finalGraphPath;
-        std::list<T*> allVertices;
-        std::list<T*> toVisit;
-        std::list<T*> partialPath;
-        std::unordered_map<int,std::unordered_map<Edge<T>*, int>> edgesStatus;
-        //map<step<map<Edge, status>>
-        // at each step : the status of the edge : 0 = Undecided, 1 = Required, 2 = Deleted
-        // step (= partialPath.length) : 1 = start - when step = nbVertices -> path found, when step = 0 -> no path
-        std::unordered_map<int, int> nextAdjacentVertex;
-        //map<step, nextVertex>
-        //at each step, which would be the next neighbouring vertex to be visited
-
-        //Add all vertices to a list that contains all vertices and a list that contains those that haven't been visited yet
-        //Add all edges in the edgesStatus list (described just above)
-        int i = 0;
-        for (auto &vertex : this->adjacencyList)
+        uint32_t id = this->getVertexId(vertex);
+        if (id != NO_VERTEX && !removed[id])
         {
-            nextAdjacentVertex[i] = 0;
-            allVertices.push_back(vertex.first);
-            toVisit.push_back(vertex.first);
-            for (Edge<T>* edge : vertex.second)
-            {
-                edgesStatus[1][edge] = 0;
-            }
+            removed[id] = true;
+            removedIds.push_back(id);
         }
+    }
+    if (removedIds.empty())
+    {
+        return poppedEdges;
+    }
 
-        //Lambda function : CHECK IF PATH IS ADMISSIBLE FOR EACH VERTEX / CONNECTION (lambda function automatically gets all variable from parent function)
-        auto isPathAdmissible = [&]() mutable -> bool
+    // The remaining vertices with edges towards the removed ones, all of them without the incoming edge index
+    std::vector<bool> affected(bound, false);
+    std::vector<uint32_t> affectedIds;
+    if (this->incomingIndexEnabled)
+    {
+        for (uint32_t id : removedIds)
         {
-            bool admissible = true;
-            // Step is the length of the partialPath (step=1 means that only 1 vertex has been added to the partialPath)
-            // this variable is used to go back when no admissible path is found
-            int step = partialPath.size();
-            std::cout << step << std::endl;
-
-            //Reset edgesStatus for all edges for this step
-            for (auto &vertex : this->adjacencyList)
+            for (auto const &incomingEdge : this->incomingById[id])
             {
-                for (Edge<T>* edge : vertex.second)
+                if (!removed[incomingEdge.first] && !affected[incomingEdge.first])
                 {
-                    edgesStatus[step][edge] = 0;
+                    affected[incomingEdge.first] = true;
+                    affectedIds.push_back(incomingEdge.first);
                 }
             }
-
-            //Loop through all vertices and test if the partialPath is globally admissible up to now
-            //This part contains RULES that define if an edge is undecided/required/deleted for the next steps
-            //It also determines if the path is suitable for an extension and if not, admissible is set to false and the loop is exited
-            for(T* vertex : allVertices)
-            {
-                // === RULES TREATED IN THE NEXT SECTION ===
-                // R. Required edge rules, A. Direction assignment rules, D. Deleted edge rules, F. Failure, or termination rules
-                // ---
-                // R1. If a vertex has only one directed arc entering (leaving), then that arc is required.
-                // F1. Fail if any vertex becomes isolated, that is, has no incident arc.
-                // F2. Fail if any vertex has only one incident arc.
-                // F3. Fail if any vertex has no directed arc entering (leaving).
-
-                int edgeCount = 0;
-                Edge<T> *requiredEdge = NULL;
-
-                // ENTERING
-                for(std::pair<Edge<T>*, int> edge : edgesStatus[step])
-                {
-                    if(edge.first->getTarget() == vertex)
-                    {
-                        if(edge.second == 0)
-                        {
-                            if(edgeCount == 0)
-                            {
-                                requiredEdge = edge.first;
-                            }
-                            edgeCount++;
-                        }
-                        if(edge.second == 1)
-                        {
-                            edgeCount = 100;
-                            break;
-                        }
-                    }
+        }
+    }
+    else
+    {
+        for (uint32_t id = 0; id < bound; id++)
+        {
+            if (this->getVertex(id) != nullptr && !removed[id])
+            {
+                affectedIds.push_back(id);
+            }
+        }
+    }
+
+    // Compact the lists of the remaining vertices
+    for (uint32_t id : affectedIds)
+    {
+        EdgeList &edges = this->getEdges(id);
+        uint32_t kept = 0;
+        for (uint32_t i = 0; i < edges.size(); i++)
+        {
+            uint32_t targetId = this->getTargetId(edges[i]);
+            if (targetId != NO_VERTEX && removed[targetId])
+            {
+                if (this->edgeIndexEnabled)
+                {
+                    this->edgesByEnds.erase(edgeKey(id, targetId));
+                }
+                poppedEdges.push_back(edges[i]);
+            }
+            else
+            {
+                edges[kept++] = edges[i];
+            }
+        }
+        while (edges.size() > kept)
+        {
+            edges.pop_back();
+        }
+    }
+
+    // Pop the edges of the removed vertices, and compact the incoming edges of their remaining targets
+    std::vector<bool> stale(bound, false);
+    for (uint32_t id : removedIds)
+    {
+        for (Edge<T, W> *edge : this->getEdges(id))
+        {
+            uint32_t targetId = this->getTargetId(edge);
+            if (targetId == NO_VERTEX)
+            {
+                poppedEdges.push_back(edge);
+                continue;
+            }
+            if (this->incomingIndexEnabled && !removed[targetId] && !stale[targetId])
+            {
+                stale[targetId] = true;
+                auto &incomingEdges = this->incomingById[targetId];
+                incomingEdges.erase(std::remove_if(incomingEdges.begin(), incomingEdges.end(), [&removed](std::pair<uint32_t, Edge<T, W> *> const &incomingEdge)
+                                                   { return removed[incomingEdge.first]; }),
+                                    incomingEdges.end());
+            }
+            if (this->edgeIndexEnabled)
+            {
+                this->edgesByEnds.erase(edgeKey(id, targetId));
+            }
+            poppedEdges.push_back(edge);
+        }
+        this->getEdges(id).clear();
+    }
+
+    for (Edge<T, W> *edge : poppedEdges)
+    {
+        this->unlinkTwin(edge);
+    }
+
+    // Remove the vertices from the map
+    for (uint32_t id : removedIds)
+    {
+        T *vertex = this->getVertex(id);
+        if (this->incomingIndexEnabled)
+        {
+            this->incomingById[id].clear();
+        }
+        this->releaseVertexId(vertex);
+        this->adjacencyList.erase(vertex);
+    }
+    this->nbArcs -= poppedEdges.size();
+    this->markModified();
+
+    return poppedEdges;
+}
+
+/// @brief Removes many edges from the graph at once and deletes them
+/// @param edges A range of edges, e.g. a std::vector<Edge<T, W> *>
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The edges which are not in the graph are left untouched.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+template <typename EdgeRange>
+void Graph<T, W, Direction, EdgeAllocator>::removeEdges(const EdgeRange &edges)
+{
+    std::list<Edge<T, W>*> poppedEdges = this->popEdges(edges);
+    for (auto *edge : poppedEdges)
+    {
+        this->destroyEdge(edge);
+    }
+}
+
+/// @brief Removes many edges from the graph at once but doesn't delete them
+/// @param edges A range of edges, e.g. a std::vector<Edge<T, W> *>
+/// @returns A list of the removed edges, without the ones which were not in the graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Same result as calling popEdge() for each edge, but the edges are sorted by source, then the list of each source
+/// is compacted once, as well as the incoming edges of each target, the removed edges being found by binary search.
+/// This costs O(k log k + degrees) for k edges. The edges whose source is not in the graph, or which are not in the list
+/// of their source, e.g. prebuilt edges shared with another graph, are popped one by one.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+template <typename EdgeRange>
+std::list<Edge<T, W>*> Graph<T, W, Direction, EdgeAllocator>::popEdges(const EdgeRange &edges)
+{
+    std::list<Edge<T, W>*> poppedEdges;
+
+    // Sort the edges by source
+    std::vector<std::pair<uint32_t, Edge<T, W> *>> marked;
+    std::vector<Edge<T, W> *> misplaced;
+    for (Edge<T, W> *edge : edges)
+    {
+        uint32_t sourceId = this->getVertexId(edge->getSource());
+        if (sourceId == NO_VERTEX)
+        {
+            misplaced.push_back(edge);
+        }
+        else
+        {
+            marked.push_back(std::make_pair(sourceId, edge));
+        }
+    }
+    std::sort(marked.begin(), marked.end());
+    marked.erase(std::unique(marked.begin(), marked.end()), marked.end());
+
+    // Compact the list of each source
+    uint32_t bound = this->getVertexIdBound();
+    std::vector<std::pair<uint32_t, Edge<T, W> *>> poppedByTarget;
+    std::vector<Edge<T, W> *> popped;
+    std::vector<uint32_t> unindexed(this->edgeIndexEnabled ? bound : 0, NO_VERTEX);
+    bool hasUnindexed = false;
+    for (size_t first = 0, last = 0; first < marked.size(); first = last)
+    {
+        uint32_t sourceId = marked[first].first;
+        while (last < marked.size() && marked[last].first == sourceId)
+        {
+            last++;
+        }
+        EdgeList &sourceEdges = this->getEdges(sourceId);
+        size_t firstPopped = popped.size();
+        uint32_t kept = 0;
+        for (uint32_t i = 0; i < sourceEdges.size(); i++)
+        {
+            if (std::binary_search(marked.begin() + first, marked.begin() + last, std::make_pair(sourceId, sourceEdges[i])))
+            {
+                popped.push_back(sourceEdges[i]);
+                if (this->incomingIndexEnabled)
+                {
+                    poppedByTarget.push_back(std::make_pair(this->getTargetId(sourceEdges[i]), sourceEdges[i]));
+                }
+            }
+            else
+            {
+                sourceEdges[kept++] = sourceEdges[i];
+            }
+        }
+        while (sourceEdges.size() > kept)
+        {
+            sourceEdges.pop_back();
+        }
+        if (popped.size() - firstPopped < last - first)
+        {
+            std::vector<Edge<T, W> *> found(popped.begin() + firstPopped, popped.end());
+            std::sort(found.begin(), found.end());
+            for (size_t i = first; i < last; i++)
+            {
+                if (!std::binary_search(found.begin(), found.end(), marked[i].second))
+                {
+                    misplaced.push_back(marked[i].second);
+                }
+            }
+        }
+        for (size_t i = firstPopped; i < popped.size(); i++)
+        {
+            uint32_t targetId = this->getTargetId(popped[i]);
+            if (this->edgeIndexEnabled && targetId != NO_VERTEX)
+            {
+                auto it = this->edgesByEnds.find(edgeKey(sourceId, targetId));
+                if (it != this->edgesByEnds.end() && it->second == popped[i])
+                {
+                    this->edgesByEnds.erase(it);
+                    unindexed[targetId] = sourceId;
+                    hasUnindexed = true;
+                }
+            }
+            this->unlinkTwin(popped[i]);
+        }
+        // A remaining edge parallel to a removed one takes its place in the edge index
+        if (hasUnindexed)
+        {
+            for (Edge<T, W> *edge : sourceEdges)
+            {
+                uint32_t targetId = this->getTargetId(edge);
+                if (targetId != NO_VERTEX && unindexed[targetId] == sourceId)
+                {
+                    this->indexEdge(sourceId, edge);
+                }
+            }
+            hasUnindexed = false;
+        }
+    }
+
+    // Compact the incoming edges of each target
+    std::sort(poppedByTarget.begin(), poppedByTarget.end());
+    for (size_t first = 0, last = 0; first < poppedByTarget.size(); first = last)
+    {
+        uint32_t targetId = poppedByTarget[first].first;
+        while (last < poppedByTarget.size() && poppedByTarget[last].first == targetId)
+        {
+            last++;
+        }
+        if (targetId == NO_VERTEX)
+        {
+            continue;
+        }
+        auto begin = poppedByTarget.begin() + first;
+        auto end = poppedByTarget.begin() + last;
+        auto &incomingEdges = this->incomingById[targetId];
+        incomingEdges.erase(std::remove_if(incomingEdges.begin(), incomingEdges.end(), [&](std::pair<uint32_t, Edge<T, W> *> const &incomingEdge)
+                                           { return std::binary_search(begin, end, std::make_pair(targetId, incomingEdge.second)); }),
+                            incomingEdges.end());
+    }
+    if (!popped.empty())
+    {
+        this->nbArcs -= popped.size();
+        this->markModified();
+    }
+    poppedEdges.insert(poppedEdges.end(), popped.begin(), popped.end());
+
+    for (Edge<T, W> *edge : misplaced)
+    {
+        int nbArcs = this->nbArcs;
+        this->popEdge(edge);
+        if (this->nbArcs < nbArcs)
+        {
+            poppedEdges.push_back(edge);
+        }
+    }
+
+    return poppedEdges;
+}
+
+/// @brief Changes the weight of an edge of the graph
+/// @param edge An edge of the graph
+/// @param weight The new weight
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The edges of a graph must be reweighted through this method rather than Edge::setWeight(),
+/// so that the properties cached by the graph are invalidated. Does nothing on an unweighted graph.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::setEdgeWeight(Edge<T, W> *edge, Weight weight)
+{
+    if constexpr (WeightTraits<W>::weighted)
+    {
+        edge->setWeight(weight);
+        this->markModified();
+    }
+}
+
+/// @brief Rebuilds the vertex ids and the indexes derived from the adjacency list
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Must be called after adjacencyList has been modified directly, for instance when it is restored from a copy.
+/// Ids are reassigned in the iteration order of the adjacency list, the sources of the edges are reset to the vertex
+/// whose list holds them, and the twins are linked again.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::rebuildIndexes()
+{
+    this->vertexTable.clear();
+    this->adjacencyById.clear();
+    this->vertexIds.clear();
+    this->freeIds.clear();
+    this->vertexIds.reserve(this->adjacencyList.size());
+    for (auto &vertexPair : this->adjacencyList)
+    {
+        this->assignVertexId(vertexPair.first, &vertexPair.second);
+    }
+    this->nbArcs = 0;
+    std::vector<std::pair<uint32_t, Edge<T, W> *>> ownedEdges;
+    for (auto &vertexPair : this->adjacencyList)
+    {
+        uint32_t sourceId = this->getVertexId(vertexPair.first);
+        for (Edge<T, W> *edge : vertexPair.second)
+        {
+            edge->source = vertexPair.first;
+            edge->targetIdHint = this->getVertexId(edge->getTarget());
+            if (Direction::directed && this->edgeAllocator.owns(edge))
+            {
+                edge->twin = nullptr;
+                ownedEdges.push_back(std::make_pair(sourceId, edge));
+            }
+        }
+        this->nbArcs += vertexPair.second.size();
+    }
+    this->setIncomingEdgeIndex(this->incomingIndexEnabled);
+    this->setEdgeIndex(this->edgeIndexEnabled);
+    this->linkTwins(ownedEdges);
+    this->markModified();
+}
+
+/// @brief Enables or disables the index of the incoming edges of each vertex
+/// @param enabled Whether the index must be maintained
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The index is kept up to date by the modifiers. It makes indegree queries O(1)
+/// and vertex or edge removal proportional to the degrees of the vertices involved instead of a full-graph pass,
+/// at the cost of one additional entry per edge.
+///
+/// An undirected graph needs the index to follow its edges backwards, so it cannot be disabled.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::setIncomingEdgeIndex(bool enabled)
+{
+    enabled = enabled || !Direction::directed;
+    this->incomingIndexEnabled = enabled;
+    this->incomingById.clear();
+    if (enabled)
+    {
+        this->incomingById.resize(this->getVertexIdBound());
+        for (uint32_t id = 0; id < this->getVertexIdBound(); id++)
+        {
+            if (this->getVertex(id) != nullptr)
+            {
+                for (Edge<T, W> *edge : this->getEdges(id))
+                {
+                    this->indexIncomingEdge(id, edge);
                 }
+            }
+        }
+    }
+}
+
+/// @brief Returns whether the incoming edges of each vertex are indexed
+/// @returns Whether the incoming edge index is enabled
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::hasIncomingEdgeIndex()
+{
+    return this->incomingIndexEnabled;
+}
+
+/// @brief Adds an edge to the incoming edge index, if it is enabled
+/// @param sourceId The id of the source vertex
+/// @param edge The edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::indexIncomingEdge(uint32_t sourceId, Edge<T, W> *edge)
+{
+    uint32_t targetId = this->getTargetId(edge);
+    if (this->incomingIndexEnabled && targetId != NO_VERTEX)
+    {
+        this->incomingById[targetId].push_back(std::make_pair(sourceId, edge));
+    }
+}
+
+/// @brief Removes an edge from the incoming edge index, if it is enabled
+/// @param edge The edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::unindexIncomingEdge(Edge<T, W> *edge)
+{
+    uint32_t targetId = this->getTargetId(edge);
+    if (this->incomingIndexEnabled && targetId != NO_VERTEX)
+    {
+        auto &incomingEdges = this->incomingById[targetId];
+        for (auto it = incomingEdges.begin(); it != incomingEdges.end(); ++it)
+        {
+            if (it->second == edge)
+            {
+                *it = incomingEdges.back();
+                incomingEdges.pop_back();
+                return;
+            }
+        }
+    }
+}
+
+/// @brief Enables or disables the index of the edges by their end vertices
+/// @param enabled Whether the index must be maintained
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The index is kept up to date by the modifiers. It makes findEdge() and the duplicate check of addEdge()
+/// expected O(1) instead of a scan of the adjacency list of the source, at the cost of one hash entry per edge.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::setEdgeIndex(bool enabled)
+{
+    this->edgeIndexEnabled = enabled;
+    this->edgesByEnds.clear();
+    if (enabled)
+    {
+        for (uint32_t id = 0; id < this->getVertexIdBound(); id++)
+        {
+            if (this->getVertex(id) != nullptr)
+            {
+                for (Edge<T, W> *edge : this->getEdges(id))
+                {
+                    this->indexEdge(id, edge);
+                }
+            }
+        }
+    }
+}
+
+/// @brief Returns whether the edges are indexed by their end vertices
+/// @returns Whether the edge index is enabled
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::hasEdgeIndex()
+{
+    return this->edgeIndexEnabled;
+}
+
+/// @brief Packs the ids of the end vertices of an edge into a key of the edge index
+/// @param sourceId The id of the source vertex
+/// @param targetId The id of the target vertex
+/// @returns The key
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+uint64_t Graph<T, W, Direction, EdgeAllocator>::edgeKey(uint32_t sourceId, uint32_t targetId)
+{
+    return (uint64_t(sourceId) << 32) | targetId;
+}
+
+/// @brief Adds an edge to the edge index, if it is enabled
+/// @param sourceId The id of the source vertex
+/// @param edge The edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// When several prebuilt edges share the same end vertices, only the first one is indexed.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::indexEdge(uint32_t sourceId, Edge<T, W> *edge)
+{
+    uint32_t targetId = this->getTargetId(edge);
+    if (this->edgeIndexEnabled && targetId != NO_VERTEX)
+    {
+        this->edgesByEnds.emplace(edgeKey(sourceId, targetId), edge);
+    }
+}
+
+/// @brief Removes an edge from the edge index, if it is enabled
+/// @param sourceId The id of the source vertex
+/// @param edge The edge, already removed from the adjacency list of the source
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// If another edge with the same end vertices remains, it takes the place of the removed one.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::unindexEdge(uint32_t sourceId, Edge<T, W> *edge)
+{
+    uint32_t targetId = this->getTargetId(edge);
+    if (!this->edgeIndexEnabled || sourceId == NO_VERTEX || targetId == NO_VERTEX)
+    {
+        return;
+    }
+    auto it = this->edgesByEnds.find(edgeKey(sourceId, targetId));
+    if (it != this->edgesByEnds.end() && it->second == edge)
+    {
+        this->edgesByEnds.erase(it);
+        for (Edge<T, W> *parallelEdge : this->getEdges(sourceId))
+        {
+            if (parallelEdge->getTarget() == edge->getTarget())
+            {
+                this->edgesByEnds.emplace(edgeKey(sourceId, targetId), parallelEdge);
+                return;
+            }
+        }
+    }
+}
+
+/// @brief Links the edges created by the graph with the edge in the opposite direction, if it has no twin yet
+/// @param candidates Edges created by the graph without twin, as pairs of (source id, edge)
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The candidates are bucketed by target, then the outgoing edges of each target are stamped by their own target,
+/// so each candidate finds its reverse edge in O(1). This costs O(V + candidates + outdegrees of their targets).
+/// Does nothing on an undirected graph, whose edges are stored once.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::linkTwins(const std::vector<std::pair<uint32_t, Edge<T, W> *>> &candidates)
+{
+    if (!Direction::directed || candidates.empty())
+    {
+        return;
+    }
+    uint32_t bound = this->getVertexIdBound();
+    std::vector<uint32_t> offsets(bound + 1, 0);
+    for (auto const &candidate : candidates)
+    {
+        uint32_t targetId = this->getTargetId(candidate.second);
+        if (targetId != NO_VERTEX)
+        {
+            offsets[targetId + 1]++;
+        }
+    }
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        offsets[id + 1] += offsets[id];
+    }
+    std::vector<std::pair<uint32_t, Edge<T, W> *>> byTarget(offsets[bound]);
+    {
+        std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+        for (auto const &candidate : candidates)
+        {
+            uint32_t targetId = this->getTargetId(candidate.second);
+            if (targetId != NO_VERTEX)
+            {
+                byTarget[next[targetId]++] = candidate;
+            }
+        }
+    }
+
+    std::vector<Edge<T, W> *> reverseEdges(bound, nullptr);
+    std::vector<uint32_t> stamps(bound, NO_VERTEX);
+    for (uint32_t targetId = 0; targetId < bound; targetId++)
+    {
+        if (offsets[targetId] == offsets[targetId + 1])
+        {
+            continue;
+        }
+        for (Edge<T, W> *edge : this->getEdges(targetId))
+        {
+            uint32_t sourceId = this->getTargetId(edge);
+            if (sourceId != NO_VERTEX && edge->twin == nullptr && stamps[sourceId] != targetId)
+            {
+                stamps[sourceId] = targetId;
+                reverseEdges[sourceId] = edge;
+            }
+        }
+        for (uint32_t i = offsets[targetId]; i < offsets[targetId + 1]; i++)
+        {
+            Edge<T, W> *edge = byTarget[i].second;
+            uint32_t sourceId = byTarget[i].first;
+            if (stamps[sourceId] != targetId || edge->twin != nullptr)
+            {
+                continue;
+            }
+            Edge<T, W> *reverseEdge = reverseEdges[sourceId];
+            if (reverseEdge != edge && reverseEdge->twin == nullptr && this->edgeAllocator.owns(reverseEdge))
+            {
+                edge->twin = reverseEdge;
+                reverseEdge->twin = edge;
+            }
+        }
+    }
+}
+
+/// @brief Unlinks an edge created by the graph from its twin, when it is removed from the graph
+/// @param edge An edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The twins of the edges shared with other graphs, e.g. the results of the algorithms, are left to the graph which created them.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::unlinkTwin(Edge<T, W> *edge)
+{
+    if (edge->twin != nullptr && this->edgeAllocator.owns(edge))
+    {
+        if (edge->twin->twin == edge)
+        {
+            edge->twin->twin = nullptr;
+        }
+        edge->twin = nullptr;
+    }
+}
+
+/// @brief Returns the edge in the opposite direction of an edge of the graph
+/// @param sourceId The id of the source vertex of the edge
+/// @param edge An edge of the graph
+/// @returns The reverse edge, nullptr if there is none
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The twin of an edge created by the graph is in the graph as well, otherwise the reverse edge is looked up.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Edge<T, W> *Graph<T, W, Direction, EdgeAllocator>::getReverseEdge(uint32_t sourceId, Edge<T, W> *edge)
+{
+    if (edge->twin != nullptr && this->edgeAllocator.owns(edge))
+    {
+        return edge->twin;
+    }
+    return this->findEdge(this->getTargetId(edge), sourceId);
+}
+
+/// @brief Gives a dense id to a vertex, reusing the id of a removed vertex if possible
+/// @param vertex A vertex, already inserted in the adjacency list
+/// @param edges The adjacency list of the vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::assignVertexId(T *vertex, EdgeList *edges)
+{
+    uint32_t id;
+    if (!this->freeIds.empty())
+    {
+        id = this->freeIds.back();
+        this->freeIds.pop_back();
+        this->vertexTable[id] = vertex;
+        this->adjacencyById[id] = edges;
+    }
+    else
+    {
+        id = this->vertexTable.size();
+        this->vertexTable.push_back(vertex);
+        this->adjacencyById.push_back(edges);
+        if (this->incomingIndexEnabled)
+        {
+            this->incomingById.emplace_back();
+        }
+    }
+    this->vertexIds[vertex] = id;
+}
+
+/// @brief Frees the id of a vertex so it can be reused
+/// @param vertex A vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::releaseVertexId(T *vertex)
+{
+    auto it = this->vertexIds.find(vertex);
+    if (it != this->vertexIds.end())
+    {
+        this->vertexTable[it->second] = nullptr;
+        this->adjacencyById[it->second] = nullptr;
+        this->freeIds.push_back(it->second);
+        this->vertexIds.erase(it);
+    }
+}
+
+/// @brief Returns the id of a vertex
+/// @param vertex A vertex
+/// @returns The id of the vertex, NO_VERTEX if the vertex is not in the graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Ids are dense : they range from 0 to getVertexIdBound() - 1, and stay the same as long as the vertex is in the graph.
+/// The id of a removed vertex is given to the next added vertex.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+uint32_t Graph<T, W, Direction, EdgeAllocator>::getVertexId(T *vertex)
+{
+    auto it = this->vertexIds.find(vertex);
+    return it == this->vertexIds.end() ? NO_VERTEX : it->second;
+}
+
+/// @brief Returns the vertex of an id
+/// @param id A vertex id
+/// @returns The vertex, nullptr if no vertex currently has this id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+T *Graph<T, W, Direction, EdgeAllocator>::getVertex(uint32_t id)
+{
+    return id < this->vertexTable.size() ? this->vertexTable[id] : nullptr;
+}
+
+/// @brief Returns the bound of the vertex ids, to size the per-vertex arrays of the algorithms
+/// @returns A value greater than every vertex id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+uint32_t Graph<T, W, Direction, EdgeAllocator>::getVertexIdBound()
+{
+    return this->vertexTable.size();
+}
+
+/// @brief Returns the id of the target vertex of an edge
+/// @param edge An edge of the graph
+/// @returns The id of the target vertex, NO_VERTEX if it is not in the graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The id cached in the edge is used when it matches the vertex table, so no hashing is needed for the edges created by this graph.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+uint32_t Graph<T, W, Direction, EdgeAllocator>::getTargetId(Edge<T, W> *edge)
+{
+    uint32_t id = edge->targetIdHint;
+    if (id < this->vertexTable.size() && this->vertexTable[id] == edge->getTarget())
+    {
+        return id;
+    }
+    return this->getVertexId(edge->getTarget());
+}
+
+/// @brief Returns the adjacency list of a vertex without hashing
+/// @param id A vertex id
+/// @returns The outgoing edges of the vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+typename Graph<T, W, Direction, EdgeAllocator>::EdgeList &Graph<T, W, Direction, EdgeAllocator>::getEdges(uint32_t id)
+{
+    return *this->adjacencyById[id];
+}
+
+/// @brief Returns the incoming edges of a vertex
+/// @param id A vertex id
+/// @returns Pairs of (source id, edge) for each edge targeting the vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Only available when the incoming edge index is enabled, see setIncomingEdgeIndex().
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+const std::vector<std::pair<uint32_t, Edge<T, W> *>> &Graph<T, W, Direction, EdgeAllocator>::getIncomingEdges(uint32_t id)
+{
+    return this->incomingById[id];
+}
+
+/// @brief Returns the edge going from a vertex to another
+/// @param source The source vertex
+/// @param target The target vertex
+/// @returns The edge, nullptr if there is none
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Edge<T, W> *Graph<T, W, Direction, EdgeAllocator>::findEdge(T *source, T *target)
+{
+    return this->findEdge(this->getVertexId(source), this->getVertexId(target));
+}
+
+/// @brief Returns the edge going from a vertex to another
+/// @param sourceId The id of the source vertex
+/// @param targetId The id of the target vertex
+/// @returns The edge, nullptr if there is none
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Expected O(1) with the edge index, see setEdgeIndex(), otherwise linear in the outdegree of the source.
+/// On an undirected graph, the edge may be stored in the opposite direction.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Edge<T, W> *Graph<T, W, Direction, EdgeAllocator>::findEdge(uint32_t sourceId, uint32_t targetId)
+{
+    T *target = this->getVertex(targetId);
+    if (this->getVertex(sourceId) == nullptr || target == nullptr)
+    {
+        return nullptr;
+    }
+    if (this->edgeIndexEnabled)
+    {
+        auto it = this->edgesByEnds.find(edgeKey(sourceId, targetId));
+        if (it == this->edgesByEnds.end() && !Direction::directed)
+        {
+            it = this->edgesByEnds.find(edgeKey(targetId, sourceId));
+        }
+        return it == this->edgesByEnds.end() ? nullptr : it->second;
+    }
+    for (Edge<T, W> *edge : this->getEdges(sourceId))
+    {
+        if (edge->getTarget() == target)
+        {
+            return edge;
+        }
+    }
+    if constexpr (!Direction::directed)
+    {
+        for (auto const &incomingEdge : this->incomingById[sourceId])
+        {
+            if (incomingEdge.first == targetId)
+            {
+                return incomingEdge.second;
+            }
+        }
+    }
+    return nullptr;
+}
 
-                if(edgeCount == 1)
-                {
-                    edgesStatus[step][requiredEdge] = 1;
-                    //delete reverse edge (if exists) : delete all edges B of which target Bt are source As of an edge A (our edge) of which At is Bs
-                    for(std::pair<T*,std::list<Edge<T>*>> vertexAsBt : this->adjacencyList)
-                    {
-                        for(Edge<T>* edgeA : vertexAsBt.second)
-                        {
-                            if(edgeA == requiredEdge)
-                            {
-                                for(Edge<T>* reverseEdgeB : this->adjacencyList[edgeA->getTarget()])
-                                {
-                                    if(reverseEdgeB->getTarget() == vertexAsBt.first)
-                                    {
-                                        edgesStatus[step][requiredEdge] = 2;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+/// @brief Visits the neighbours of a vertex, i.e. the vertices reached by following its edges
+/// @param id A vertex id
+/// @param visit A callable taking the id of the neighbour and the edge leading to it
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// On a directed graph, these are the targets of the outgoing edges. On an undirected graph, the edges stored
+/// by the neighbours are visited as well, a loop being visited once.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+template <typename Visitor>
+void Graph<T, W, Direction, EdgeAllocator>::forEachNeighbour(uint32_t id, Visitor visit)
+{
+    for (Edge<T, W> *edge : this->getEdges(id))
+    {
+        visit(this->getTargetId(edge), edge);
+    }
+    if constexpr (!Direction::directed)
+    {
+        for (auto const &incomingEdge : this->incomingById[id])
+        {
+            if (incomingEdge.first != id)
+            {
+                visit(incomingEdge.first, incomingEdge.second);
+            }
+        }
+    }
+}
 
-                if(edgeCount == 0)
-                {
-                    admissible = false;
-                    std::cout << "not admissible 1 : entering edges" << std::endl;
-                }
+/// @brief Returns whether the graph is eulerian
+/// @returns Whether the graph has an eulerian circuit
+/// @author Damien Tschan
+/// @date 08.05.2023
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::isEulerian()
+{
+    return this->getEulerianKind() == EulerianKind::Circuit;
+}
 
-                // LEAVING
-                for(Edge<T>* edge : this->adjacencyList[vertex])
-                {
-                    if(edgesStatus[step].find(edge) != edgesStatus[step].end())
-                    {
-                        if(edgesStatus[step][edge] == 0)
-                        {
-                            if(edgeCount == 0)
-                            {
-                                requiredEdge = edge;
-                            }
-                            edgeCount++;
-                        }
-                        if (edgesStatus[step][edge] == 1)
-                        {
-                            edgeCount = 100;
-                            break;
-                        }
-                    }
-                }
+/// @brief Returns whether the graph has an eulerian circuit, only an eulerian path, or neither
+/// @returns The kind of eulerian walk the graph has
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The vertices that have edges must be connected, the isolated vertices being ignored.
+/// An oriented graph has a circuit when each vertex has as many incoming as outgoing edges, and a path when a single vertex
+/// has one more outgoing edge and a single vertex one more incoming edge.
+/// Otherwise, the graph is walked as an undirected graph, each pair of opposite edges of a directed graph being a single edge
+/// (see getNbEdges()) : it has a circuit when every vertex has an even degree, a loop counting twice,
+/// and a path when exactly two vertices have an odd degree.
+/// A graph without edges has an empty circuit. The degrees are counted in a single pass over the edges, in O(V+E).
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+EulerianKind Graph<T, W, Direction, EdgeAllocator>::getEulerianKind()
+{
+    // Oriented graphs count the difference between the outdegree and the indegree, the others the degree
+    bool bothWays = !Direction::directed || !this->isOriented();
+    uint32_t bound = this->getVertexIdBound();
+    std::vector<int> balances(bound, 0);
+    std::vector<bool> hasEdges(bound, false);
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        if (this->vertexTable[id] == nullptr)
+        {
+            continue;
+        }
+        for (Edge<T, W> *edge : this->getEdges(id))
+        {
+            uint32_t targetId = this->getTargetId(edge);
+            if (targetId == NO_VERTEX)
+            {
+                return EulerianKind::None;
+            }
+            if (Direction::directed && bothWays && targetId < id)
+            {
+                continue; // the opposite of an edge already counted
+            }
+            balances[id]++;
+            balances[targetId] += bothWays ? 1 : -1;
+            hasEdges[id] = hasEdges[targetId] = true;
+        }
+    }
 
-                if(edgeCount == 1)
-                {
-                    edgesStatus[step][requiredEdge] = 1;
-                    //delete reverse edge (if exists) : delete all edges B of which target Bt are source As of an edge A (our edge) of which At is Bs
-                    for(std::pair<T*,std::list<Edge<T>*>> vertexAsBt : this->adjacencyList)
-                    {
-                        for(Edge<T>* edgeA : vertexAsBt.second)
-                        {
-                            if(edgeA == requiredEdge)
-                            {
-                                for(Edge<T>* reverseEdgeB : this->adjacencyList[edgeA->getTarget()])
-                                {
-                                    if(reverseEdgeB->getTarget() == vertexAsBt.first)
-                                    {
-                                        edgesStatus[step][requiredEdge] = 2;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+    int nbStarts = 0;
+    int nbEnds = 0;
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        if (bothWays)
+        {
+            nbStarts += balances[id] % 2 != 0;
+        }
+        else if (balances[id] == 1)
+        {
+            nbStarts++;
+        }
+        else if (balances[id] == -1)
+        {
+            nbEnds++;
+        }
+        else if (balances[id] != 0)
+        {
+            return EulerianKind::None;
+        }
+    }
+    bool circuit = nbStarts == 0 && nbEnds == 0;
+    bool path = bothWays ? nbStarts == 2 : nbStarts == 1 && nbEnds == 1;
+    if (!circuit && !path)
+    {
+        return EulerianKind::None;
+    }
 
-                if(edgeCount == 0)
-                {
-                    admissible = false;
-                    std::cout << "not admissible 2 : exiting edges" << std::endl;
-                }
+    ConnectedComponents components = this->getConnectedComponents();
+    uint32_t component = ConnectedComponents::NO_COMPONENT;
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        if (hasEdges[id])
+        {
+            if (component == ConnectedComponents::NO_COMPONENT)
+            {
+                component = components.labels[id];
+            }
+            else if (components.labels[id] != component)
+            {
+                return EulerianKind::None;
+            }
+        }
+    }
+    return circuit ? EulerianKind::Circuit : EulerianKind::Path;
+}
+
+/// @brief Returns an eulerian circuit of the graph, or else an eulerian path
+/// @returns The edges in the order they are walked through, empty if the graph has neither or has no edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// This method uses Hierholzer's algorithm in O(V+E), made iterative with an explicit stack of the walked edges.
+/// A path starts from the vertex with an extra outgoing edge, or from a vertex of odd degree.
+/// When a pair of opposite edges is walked through, the edge going in the walked direction is returned, which on an
+/// undirected graph is the edge itself, possibly walked from its target to its source. See getEulerianKind().
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+std::vector<Edge<T, W> *> Graph<T, W, Direction, EdgeAllocator>::getEulerianPath()
+{
+    std::vector<Edge<T, W> *> walk;
+    EulerianKind kind = this->getEulerianKind();
+    if (kind == EulerianKind::None || this->nbArcs == 0)
+    {
+        return walk;
+    }
+
+    // The edges that can be walked through from the vertex `id` are the range [offsets[id], offsets[id + 1]) of arcs,
+    // as pairs of (vertex reached, index of the edge in edges). An edge walked both ways is listed at both ends.
+    bool bothWays = !Direction::directed || !this->isOriented();
+    uint32_t bound = this->getVertexIdBound();
+    std::vector<Edge<T, W> *> edges;
+    edges.reserve(this->nbArcs);
+    std::vector<uint32_t> sourceIds;
+    sourceIds.reserve(this->nbArcs);
+    std::vector<uint32_t> offsets(bound + 1, 0);
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        if (this->vertexTable[id] == nullptr)
+        {
+            continue;
+        }
+        for (Edge<T, W> *edge : this->getEdges(id))
+        {
+            uint32_t targetId = this->getTargetId(edge);
+            if (Direction::directed && bothWays && targetId < id)
+            {
+                continue;
+            }
+            edges.push_back(edge);
+            sourceIds.push_back(id);
+            offsets[id + 1]++;
+            if (bothWays)
+            {
+                offsets[targetId + 1]++;
+            }
+        }
+    }
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        offsets[id + 1] += offsets[id];
+    }
+    std::vector<std::pair<uint32_t, uint32_t>> arcs(offsets[bound]);
+    std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+    for (uint32_t index = 0; index < edges.size(); index++)
+    {
+        uint32_t sourceId = sourceIds[index];
+        uint32_t targetId = this->getTargetId(edges[index]);
+        arcs[next[sourceId]++] = std::make_pair(targetId, index);
+        if (bothWays)
+        {
+            arcs[next[targetId]++] = std::make_pair(sourceId, index);
+        }
+    }
+
+    // Starting vertex
+    uint32_t start = NO_VERTEX;
+    for (uint32_t id = 0; id < bound && start == NO_VERTEX; id++)
+    {
+        int nbWalkable = offsets[id + 1] - offsets[id];
+        if (kind == EulerianKind::Circuit ? nbWalkable > 0
+                                          : (bothWays ? nbWalkable % 2 != 0 : nbWalkable == this->getVertexIndegree(id) + 1))
+        {
+            start = id;
+        }
+    }
 
-                // === RULES TREATED IN THE NEXT SECTION ===
-                // R. Required edge rules, A. Direction assignment rules, D. Deleted edge rules, F. Failure, or termination rules
-                // ---
-                // R2. If a vertex has only two arcs incident, then both arcs are required.
-                if(this->getVertexIndegree(vertex)+this->getVertexOutdegree(vertex) == 2)
+    // Walks until stuck, which can only happen at the end of the walk, then backtracks and splices in the detours
+    const uint32_t NO_EDGE = UINT32_MAX;
+    std::copy(offsets.begin(), offsets.end() - 1, next.begin());
+    std::vector<bool> used(edges.size(), false);
+    std::vector<std::pair<uint32_t, uint32_t>> stack; // pairs of (vertex, index of the edge walked to reach it)
+    stack.push_back(std::make_pair(start, NO_EDGE));
+    while (!stack.empty())
+    {
+        uint32_t vertex = stack.back().first;
+        while (next[vertex] < offsets[vertex + 1] && used[arcs[next[vertex]].second])
+        {
+            next[vertex]++;
+        }
+        if (next[vertex] < offsets[vertex + 1])
+        {
+            std::pair<uint32_t, uint32_t> arc = arcs[next[vertex]++];
+            used[arc.second] = true;
+            stack.push_back(arc);
+        }
+        else
+        {
+            uint32_t index = stack.back().second;
+            stack.pop_back();
+            if (index != NO_EDGE)
+            {
+                // An edge walked backwards is replaced by the reverse edge, which is looked up if it is not its twin
+                Edge<T, W> *edge = edges[index];
+                if (Direction::directed && this->getTargetId(edge) != vertex)
                 {
-                    for(auto edge : edgesStatus[step])
-                    {
-                        if(edge.first->getTarget() == vertex)
-                        {
-                            if(edge.second == 0)
-                                edge.second = 1;
-                            else if(edge.second == 2)
-                            {
-                                admissible = false;
-                                std::cout << "not admissible 3 : only two arcs, but one already deleted" << std::endl;
-                            }
-                        }
-                        for(auto vertex : this->adjacencyList)
-                        {
-                            if(std::find(vertex.second.begin(),vertex.second.end(),edge.first) != vertex.second.end())
-                            {
-                                if(edge.second == 0)
-                                {
-                                    edge.second = 1;
-                                    //delete reverse edge (if exists) : delete all edges B of which target Bt are source As of an edge A (our edge) of which At is Bs
-                                    for(std::pair<T*,std::list<Edge<T>*>> vertexAsBt : this->adjacencyList)
-                                    {
-                                        for(Edge<T>* edgeA : vertexAsBt.second)
-                                        {
-                                            if(edgeA == edge.first)
-                                            {
-                                                for(Edge<T>* reverseEdgeB : this->adjacencyList[edgeA->getTarget()])
-                                                {
-                                                    if(reverseEdgeB->getTarget() == vertexAsBt.first)
-                                                    {
-                                                        edgesStatus[step][requiredEdge] = 2;
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-                                else if(edge.second == 2)
-                                {
-                                    admissible = false;
-                                    std::cout << "not admissible 4 : only two arcs, but one already deleted" << std::endl;
-                                }
-                            }
-                        }
-                    }
+                    Edge<T, W> *reverseEdge = this->getReverseEdge(sourceIds[index], edge);
+                    edge = reverseEdge != nullptr ? reverseEdge : edge;
                 }
-                // === RULES TREATED IN THE NEXT SECTION ===
-                // R. Required edge rules, A. Direction assignment rules, D. Deleted edge rules, F. Failure, or termination rules
-                // ---
-                // D2. If a vertex has a required directed arc entering (leaving), then all undecided directed arcs entering (leaving) may be deleted.
-                for(auto edge : edgesStatus[step])
+                walk.push_back(edge);
+            }
+        }
+    }
+    std::reverse(walk.begin(), walk.end());
+    return walk;
+}
+
+/// @brief Returns whether the graph is hamiltonian
+/// @returns Whether the graph is hamiltonian
+/// @author Damien Tschan
+/// @date 05.06.2023
+///
+/// The search has no time limit : beyond HeldKarp::MAX_VERTICES vertices, it is a branch and bound which may run
+/// for an exponential time before it concludes. Callers which must return use getHamiltonianStatus() with a time limit.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::isHamiltonian()
+{
+    return this->getHamiltonianStatus(std::chrono::milliseconds::zero()) == HamiltonianStatus::Found;
+}
+
+/// @brief Returns whether the graph is hamiltonian, or that the search gave up before knowing it
+/// @param timeLimit The time after which the search of a large graph gives up, zero for no limit
+/// @param cancelled A flag set from another thread to stop the search of a large graph, nullptr if it cannot be cancelled
+/// @returns Found if the graph has a hamiltonian circuit, None if it has none, Interrupted if the search gave up
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Graphs of at most HeldKarp::MAX_VERTICES vertices are always decided, as by isHamiltonian().
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+HamiltonianStatus Graph<T, W, Direction, EdgeAllocator>::getHamiltonianStatus(std::chrono::milliseconds timeLimit, const std::atomic<bool> *cancelled)
+{
+    HamiltonianStatus status;
+    this->getHamiltonianPathEdges(true, timeLimit, cancelled, &status);
+    return status;
+}
+
+/// @brief Returns the hamiltonian path of a graph
+/// @param circuit Whether the path must come back to its first vertex, which is what isHamiltonian() checks
+/// @param timeLimit The time after which the search of a large graph gives up, zero for no limit
+/// @param cancelled A flag set from another thread to stop the search of a large graph, nullptr if it cannot be cancelled
+/// @param status If not nullptr, set to whether a path was found, proved not to exist, or the search was interrupted
+/// @returns The edges of the hamiltonian path in the order they are followed if it exists, an empty vector otherwise
+/// @author Damien Tschan
+/// @date 09.06.2023
+///
+/// Graphs of up to HeldKarp::MAX_VERTICES vertices are searched exactly by the dynamic programming of HeldKarp,
+/// in at most a few seconds, and larger ones by the branch-and-bound search of HamiltonianSearch, which the time limit
+/// and the cancellation flag apply to. Both run on a snapshot of the graph.
+///
+/// The graphs that are not oriented are searched as undirected ones, so that a circuit never goes back
+/// along the edge it came from.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+std::vector<Edge<T, W> *> Graph<T, W, Direction, EdgeAllocator>::getHamiltonianPathEdges(bool circuit, std::chrono::milliseconds timeLimit,
+                                                                                       const std::atomic<bool> *cancelled, HamiltonianStatus *status)
+{
+    CompactGraph<T, W> snapshot = this->freeze();
+    bool symmetric = !Direction::directed || !this->isOriented();
+    HamiltonianSearchResult result;
+    if (snapshot.getNbVertices() <= HeldKarp<W>::MAX_VERTICES - (circuit ? 0 : 1))
+    {
+        std::unique_ptr<ThreadPool> pool;
+        if (snapshot.getNbVertices() >= HeldKarp<W>::PARALLEL_VERTICES)
+        {
+            pool.reset(new ThreadPool());
+        }
+        HeldKarp<W> search(snapshot, pool.get(), symmetric);
+        result.edgeIds = circuit ? search.findCircuit() : search.findPath();
+        bool found = !result.edgeIds.empty() || (!circuit && snapshot.getNbVertices() == 1);
+        result.status = found ? HamiltonianStatus::Found : HamiltonianStatus::None;
+    }
+    else
+    {
+        HamiltonianSearch<W> search(snapshot, symmetric);
+        result = circuit ? search.findCircuit(timeLimit, cancelled) : search.findPath(timeLimit, cancelled);
+    }
+
+    if (status != nullptr)
+    {
+        *status = result.status;
+    }
+    std::vector<Edge<T, W> *> path;
+    path.reserve(result.edgeIds.size());
+    for (uint32_t edgeId : result.edgeIds)
+    {
+        path.push_back(snapshot.getEdge(edgeId));
+    }
+    return path;
+}
+
+/// @brief Returns whether the graph is connected
+/// @returns Whether the graph is connected
+/// @author Damien Tschan
+/// @date 08.05.2023
+///
+/// A directed graph is connected when it is weakly connected, i.e. connected once the direction of its edges is ignored.
+/// See getConnectedComponents().
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::isConnected()
+{
+    if (this->adjacencyList.size() < 2)
+    {
+        return true;
+    }
+    return this->getConnectedComponents().isConnected();
+}
+
+/// @brief Returns the connected components of the graph, weakly connected for directed graphs
+/// @returns The component of each vertex id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The components are labelled by breadth-first searches over the vertex ids, with a flat queue, in O(V+E).
+/// The edges of a directed graph are followed both ways : backwards through the incoming edge index when it is enabled,
+/// or else through flat arrays of the reverse edges built for the occasion.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+ConnectedComponents Graph<T, W, Direction, EdgeAllocator>::getConnectedComponents()
+{
+    ConnectedComponents components;
+    uint32_t bound = this->getVertexIdBound();
+    components.labels.assign(bound, ConnectedComponents::NO_COMPONENT);
+
+    // The sources of the edges reaching the vertex `id` are the range [reverseOffsets[id], reverseOffsets[id + 1]) of reverseSources
+    std::vector<uint32_t> reverseOffsets;
+    std::vector<uint32_t> reverseSources;
+    bool reverseArrays = Direction::directed && !this->incomingIndexEnabled;
+    if (reverseArrays)
+    {
+        reverseOffsets.assign(bound + 1, 0);
+        for (uint32_t id = 0; id < bound; id++)
+        {
+            if (this->vertexTable[id] != nullptr)
+            {
+                for (Edge<T, W> *edge : this->getEdges(id))
                 {
-                    if(edge.first->getTarget() == vertex)
-                    {
-                        if(edge.second == 1)
-                        {
-                            for(auto edge2 : edgesStatus[step])
-                            {
-                                if(edge2.first->getTarget() == vertex && edge2.first != edge.first)
-                                {
-                                    if(edge2.second == 0)
-                                        edge2.second = 2;
-                                }
-                            }
-                        }
-                    }
-                    for(auto vertex2 : this->adjacencyList)
+                    uint32_t targetId = this->getTargetId(edge);
+                    if (targetId != NO_VERTEX)
                     {
-                        if(std::find(vertex2.second.begin(),vertex2.second.end(),edge.first) != vertex2.second.end())
-                        {
-                            if(edge.second == 1)
-                            {
-                                for(auto edge2 : edgesStatus[step])
-                                {
-                                    for(auto vertex3 : this->adjacencyList)
-                                    {
-                                        if(std::find(vertex3.second.begin(),vertex3.second.end(),edge2.first) != vertex3.second.end())
-                                        {
-                                            if(edge2.first->getTarget() == vertex3.first && edge2 != edge)
-                                            {
-                                                if(edge2.second == 0)
-                                                    edge2.second = 2;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
+                        reverseOffsets[targetId + 1]++;
                     }
                 }
-
-                // === RULES TREATED IN THE NEXT SECTION ===
-                // R. Required edge rules, A. Direction assignment rules, D. Deleted edge rules, F. Failure, or termination rules
-                // ---
-                // F4. Fail if any vertex has two required directed arcs entering (leaving).
-                // F5. Fail if any vertex has three required arcs incident.
-                int requEntering = 0;
-                int requLeaving = 0;
-                for(auto edge : edgesStatus[step])
+            }
+        }
+        for (uint32_t id = 0; id < bound; id++)
+        {
+            reverseOffsets[id + 1] += reverseOffsets[id];
+        }
+        reverseSources.resize(reverseOffsets[bound]);
+        std::vector<uint32_t> nextSlot(reverseOffsets.begin(), reverseOffsets.end() - 1);
+        for (uint32_t id = 0; id < bound; id++)
+        {
+            if (this->vertexTable[id] != nullptr)
+            {
+                for (Edge<T, W> *edge : this->getEdges(id))
                 {
-                    if(edge.first->getTarget() == vertex)
-                    {
-                        if(edge.second == 1)
-                            requLeaving++;
-                    }
-                    for(auto vertex2 : this->adjacencyList)
+                    uint32_t targetId = this->getTargetId(edge);
+                    if (targetId != NO_VERTEX)
                     {
-                        if(std::find(vertex2.second.begin(),vertex2.second.end(),edge.first) != vertex2.second.end())
-                        {
-                            if(edge.second == 1)
-                                requEntering++;
-                        }
+                        reverseSources[nextSlot[targetId]++] = id;
                     }
                 }
-                if(requEntering >= 2 || requLeaving >= 2)
-                {
-                    admissible = false;
-                    std::cout << "not admissible 5 : two or more entering/leaving edges required" << std::endl;
-                }
-                if(requEntering + requLeaving >= 3)
-                {
-                    admissible = false;
-                    std::cout << "not admissible 6 : three or more edges required" << std::endl;
-                }
-
-                //The following rules are described in the algorithm but have not been implemented.
-
-                // === RULES NOT IMPLEMENTED (implementation could improve computing time) ===
-                // R. Required edge rules, A. Direction assignment rules, D. Deleted edge rules, F. Failure, or termination rules
-                // ---
-                // A1. If a vertex has a required directed arc entering (leaving), then all incident undirected
-                //     arcs are assigned the direction leaving (entering) that vertex.
-                // A2. If a vertex has a required undirected arc incident, and all other incident arcs are
-                //     leaving (entering) the vertex, then the required arc is assigned the direction entering (leaving) the vertex.
-                // D1. If a vertex has two required arcs incident, then all undecided arcs incident may be deleted.
-                // D3. Delete any arc which forms a closed circuit with required arcs, unless it completes the Hamilton circuit.
-                // F6. Fail if any set of required arcs forms a closed circuit, other than a Hamilton circuit
             }
-            //Print state of all edges
-            for(std::pair<Edge<T>*, int> edge : edgesStatus[step])
+        }
+    }
+
+    std::vector<uint32_t> toVisit;
+    toVisit.reserve(this->adjacencyList.size());
+    for (uint32_t start = 0; start < bound; start++)
+    {
+        if (this->vertexTable[start] == nullptr || components.labels[start] != ConnectedComponents::NO_COMPONENT)
+        {
+            continue;
+        }
+        uint32_t component = components.sizes.size();
+        auto reach = [&](uint32_t id)
+        {
+            if (id != NO_VERTEX && components.labels[id] == ConnectedComponents::NO_COMPONENT)
             {
-                //std::cout << "STATUS [" << step << "] : " << edge.first << " - " << edge.second << std::endl;
+                components.labels[id] = component;
+                toVisit.push_back(id);
             }
-            std::cout << "END [" << step << "], admissible : " << admissible << std::endl;
-            return admissible;
         };
 
-        // S1. Select any single node as the initial path.
-        partialPath.push_back(*allVertices.begin());
-
-        // Conditions that make the algorithm end successfully
-        bool endLoopPathFound = false;
-
-        // Conditions that make the algorithm end unsuccessfully
-        bool endLoopNoPath = false;
-
-        // This loop adds and removes vertices/edges from the partial path and launches isPathAdmissible() at each step
-        // It only ends either when a full hamiltonian path is found or when no path can be found
-        while(!(endLoopPathFound || endLoopNoPath))
+        toVisit.clear();
+        reach(start);
+        for (size_t next = 0; next < toVisit.size(); next++)
         {
-            // S2. Test the path for admissibility.
-            bool pathAdmissible = isPathAdmissible();
-
-            // S3. If the path so far is admissible, list the successors of the last node chosen, and extend the path
-            //      to the first of these.
-            if(pathAdmissible)
+            uint32_t vertex = toVisit[next];
+            this->forEachNeighbour(vertex, [&](uint32_t targetId, Edge<T, W> *)
+                                   { reach(targetId); });
+            if constexpr (Direction::directed)
             {
-                //NeighboursToVisit is a list of the vertices that are adjacent to the last vertex visited and have not been visited
-                //Vertices at the front of the list are prioritized when visiting the next vertex
-                std::list<T*> neighboursToVisit;
-                T* lastVertex = partialPath.back();
-
-                //For each edge sourcing from the last vertex and targeting an unvisited vertex
-                for (auto edgeToNeighbouringVertex : this->adjacencyList[lastVertex])
+                if (reverseArrays)
                 {
-                    if (std::find(toVisit.begin(), toVisit.end(), edgeToNeighbouringVertex->getTarget()) != toVisit.end())
+                    for (uint32_t r = reverseOffsets[vertex]; r < reverseOffsets[vertex + 1]; r++)
                     {
-                        // If an edge is required by the previous steps of the algorithm, it's target is pushed at the front of the list
-                        if(edgesStatus[partialPath.size()][edgeToNeighbouringVertex] == 1)
-                        {
-                            neighboursToVisit.push_front(edgeToNeighbouringVertex->getTarget());
-                        }
-                        // If an edge is still undecided by the previous steps of the algorithm, it's target is pushed at the back of the list
-                        if(edgesStatus[partialPath.size()][edgeToNeighbouringVertex] == 0)
-                        {
-                            neighboursToVisit.push_back(edgeToNeighbouringVertex->getTarget());
-                        }
+                        reach(reverseSources[r]);
                     }
                 }
-                //nextAdjacentVertex is used to cycle through the available adjacentVertices to visit
-                //if nextAdjacentVertex is inferior to the number of neighbours to visit, visit the next vertex
-                if(nextAdjacentVertex[partialPath.size()] < (int)neighboursToVisit.size())
+                else
                 {
-                    //picking the first unvisited vertex of the neighbours available (the first one has the highest priority)
-                    auto firstNeighbourUnvisited = neighboursToVisit.begin();
-                    std::advance(firstNeighbourUnvisited, nextAdjacentVertex[partialPath.size()]);
-                    nextAdjacentVertex[partialPath.size()]++;
-                    //remove it from the toVisit list and push it into the partialPath
-                    //this extends the partial path and requires a new cycle to be launched (path was admissible and a new vertex has been added to the path)
-                    toVisit.remove(*firstNeighbourUnvisited);
-                    partialPath.push_back(*firstNeighbourUnvisited);
-                    //As the partial path is a list of vertices (probably a bad choice, but that's too late),
-                    // it is needed to build a list of all vertices/edges that will be added to the subgraph at the end
-                    for(Edge<T>* edge : this->adjacencyList[lastVertex])
+                    for (auto const &incomingEdge : this->incomingById[vertex])
                     {
-                        if(edge->getTarget() == *firstNeighbourUnvisited)
-                        {
-                            finalGraphPath.push_back(std::make_pair(lastVertex, edge));
-                        }
+                        reach(incomingEdge.first);
                     }
                 }
-                // S7. If a successor of the last node is the origin, a Hamilton circuit is formed
-                //if no vertex is left to visit and the last node is the first, a path has been found
-                else if(toVisit.size() == 0 && partialPath.back() == partialPath.front())
+            }
+        }
+        components.sizes.push_back(toVisit.size());
+    }
+    return components;
+}
+
+/// @brief Returns whether the graph is strongly connected
+/// @returns Whether every vertex can be reached from every other vertex by following the edges in their direction
+/// @author Damien Tschan
+/// @date 24.04.2023
+///
+/// See getStronglyConnectedComponents(). An undirected graph is strongly connected when it is connected.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::isStronglyConnected()
+{
+    if (this->adjacencyList.size() < 2)
+    {
+        return true;
+    }
+    return this->getStronglyConnectedComponents().isConnected();
+}
+
+/// @brief Returns the strongly connected components of the graph and its condensation
+/// @returns The component of each vertex id, in topological order of the condensation
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// This method uses Tarjan's algorithm in O(V+E), made iterative with an explicit stack of the vertices being explored
+/// and the position reached in their edges, so that long paths cannot overflow the call stack.
+/// The neighbours of each vertex are first gathered in flat arrays indexed by vertex id.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+StronglyConnectedComponents Graph<T, W, Direction, EdgeAllocator>::getStronglyConnectedComponents()
+{
+    StronglyConnectedComponents components;
+    uint32_t bound = this->getVertexIdBound();
+    components.labels.assign(bound, ConnectedComponents::NO_COMPONENT);
+
+    // The neighbours of the vertex `id` are the range [offsets[id], offsets[id + 1]) of targets
+    std::vector<uint32_t> offsets;
+    offsets.reserve(bound + 1);
+    std::vector<uint32_t> targets;
+    targets.reserve(Direction::directed ? this->nbArcs : 2 * this->nbArcs);
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        offsets.push_back(targets.size());
+        if (this->vertexTable[id] != nullptr)
+        {
+            this->forEachNeighbour(id, [&targets](uint32_t targetId, Edge<T, W> *)
+            {
+                if (targetId != NO_VERTEX)
                 {
-                    endLoopPathFound = true;
+                    targets.push_back(targetId);
                 }
-                // S5. If all extensions from a given node have been shown inadmissible, repeat step $4.
-                //if nextAdjacentVertex reaches the max amount of vertices neighbouring the last vertex visited,
-                // it means that all neighbours have all been unsuccessfully visited
-                // the algorithm then goes back a step by declaring the path inadmissible
-                else
+            });
+        }
+    }
+    offsets.push_back(targets.size());
+
+    // index is the discovery order of each vertex, lowest the lowest index reachable from its subtree through the stack
+    const uint32_t UNVISITED = UINT32_MAX;
+    std::vector<uint32_t> index(bound, UNVISITED);
+    std::vector<uint32_t> lowest(bound);
+    std::vector<bool> onStack(bound, false);
+    std::vector<uint32_t> stack;
+    std::vector<std::pair<uint32_t, uint32_t>> explored; // pairs of (vertex id, position of the next neighbour)
+    uint32_t nbVisited = 0;
+    std::vector<uint32_t> sinkFirstSizes; // components in the order Tarjan's algorithm closes them, sinks first
+
+    auto discover = [&](uint32_t id)
+    {
+        index[id] = lowest[id] = nbVisited++;
+        stack.push_back(id);
+        onStack[id] = true;
+        explored.push_back(std::make_pair(id, offsets[id]));
+    };
+
+    for (uint32_t start = 0; start < bound; start++)
+    {
+        if (this->vertexTable[start] == nullptr || index[start] != UNVISITED)
+        {
+            continue;
+        }
+        discover(start);
+        while (!explored.empty())
+        {
+            uint32_t vertex = explored.back().first;
+            uint32_t &next = explored.back().second;
+            if (next < offsets[vertex + 1])
+            {
+                uint32_t target = targets[next++];
+                if (index[target] == UNVISITED)
                 {
-                    pathAdmissible = false;
+                    discover(target);
                 }
-            }
-            // S4. If the path so far is inadmissible, delete the last node chosen and choose the next listed successor
-            //      of the preceding node. Repeat step S2.
-            if(!pathAdmissible)
-            {
-                //Reset the nextAdjacentVertex for when the algorithm will come back at this step
-                nextAdjacentVertex[partialPath.size()] = 0;
-                //Clear the status of all edges at this step for when the algorithm will come back
-                edgesStatus[partialPath.size()].clear();
-                //Remove the last vertex added to the partial path and put it back in the toVisit list
-                toVisit.push_back(partialPath.back());
-                partialPath.pop_back();
-                //if the list of vertices/edges to be added to the graph is not empty (if empty -> partial path empty too), remove the last pair added
-                if(!finalGraphPath.empty())
+                else if (onStack[target])
                 {
-                    finalGraphPath.pop_back();
+                    lowest[vertex] = std::min(lowest[vertex], index[target]);
                 }
-                // S6. If all extensions from the initial node have been shown inadmissible, then no circuit exists.
-                // if the partial path is reduced until it reaches 0, no hamiltonian path can be found in this graph
-                if(partialPath.size() == 0)
+                continue;
+            }
+
+            explored.pop_back();
+            if (!explored.empty())
+            {
+                uint32_t parent = explored.back().first;
+                lowest[parent] = std::min(lowest[parent], lowest[vertex]);
+            }
+            if (lowest[vertex] == index[vertex])
+            {
+                // The vertex is the root of a component, made of the vertices above it on the stack
+                uint32_t component = sinkFirstSizes.size();
+                uint32_t size = 0;
+                uint32_t member;
+                do
                 {
-                    endLoopNoPath = true;
-                }
+                    member = stack.back();
+                    stack.pop_back();
+                    onStack[member] = false;
+                    components.labels[member] = component;
+                    size++;
+                } while (member != vertex);
+                sinkFirstSizes.push_back(size);
             }
-            std::cout << "toVisit : " << toVisit.size() << std::endl;
         }
-
-        //if a path has been found, build a new graph from the vertices/edges list and return it
-        if(endLoopPathFound)
+    }
+
+    // RENUMBERING THE COMPONENTS IN TOPOLOGICAL ORDER
+    uint32_t nbComponents = sinkFirstSizes.size();
+    components.sizes.assign(sinkFirstSizes.rbegin(), sinkFirstSizes.rend());
+    for (uint32_t &label : components.labels)
+    {
+        if (label != ConnectedComponents::NO_COMPONENT)
+        {
+            label = nbComponents - 1 - label;
+        }
+    }
+
+    // BUILDING THE CONDENSATION
+    // The vertices are grouped by component, and stamps avoid linking the same pair of components twice
+    std::vector<uint32_t> memberOffsets(nbComponents + 1, 0);
+    for (uint32_t component = 0; component < nbComponents; component++)
+    {
+        memberOffsets[component + 1] = memberOffsets[component] + components.sizes[component];
+    }
+    std::vector<uint32_t> members(memberOffsets[nbComponents]);
+    std::vector<uint32_t> nextSlot(memberOffsets.begin(), memberOffsets.end() - 1);
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        if (components.labels[id] != ConnectedComponents::NO_COMPONENT)
+        {
+            members[nextSlot[components.labels[id]]++] = id;
+        }
+    }
+    std::vector<uint32_t> stamps(nbComponents, ConnectedComponents::NO_COMPONENT);
+    components.condensationOffsets.reserve(nbComponents + 1);
+    for (uint32_t component = 0; component < nbComponents; component++)
+    {
+        components.condensationOffsets.push_back(components.condensationTargets.size());
+        stamps[component] = component;
+        for (uint32_t m = memberOffsets[component]; m < memberOffsets[component + 1]; m++)
         {
-            Graph<T>* returnGraph = new Graph<T>();
-            for(std::pair<T*, std::list<Edge<T>*>> vertexAdjList : this->adjacencyList)
-            {
-                returnGraph->addVertex(vertexAdjList.first);
-            }
-            for(std::pair<T*, Edge<T>*> edgePair : finalGraphPath)
+            uint32_t id = members[m];
+            for (uint32_t e = offsets[id]; e < offsets[id + 1]; e++)
             {
-                returnGraph->addPrebuiltEdge(edgePair.first, edgePair.second);
+                uint32_t targetComponent = components.labels[targets[e]];
+                if (stamps[targetComponent] != component)
+                {
+                    stamps[targetComponent] = component;
+                    components.condensationTargets.push_back(targetComponent);
+                }
             }
-            return returnGraph;
         }
     }
-    //if no hamiltonian path can be found or if the graph is not connected, return an empty graph
-    Graph<T>* returnGraph = new Graph<T>();
-    return returnGraph;
+    components.condensationOffsets.push_back(components.condensationTargets.size());
+    return components;
 }
 
-/// @brief Returns whether the graph is connected
-/// @returns Whether the graph is connected
+/// @brief Returns whether the graph is oriented
+/// @returns Whether the graph is oriented
 /// @author Damien Tschan
-/// @date 08.05.2023
-template <typename T>
-bool Graph<T>::isConnected()
+/// @date 24.04.2023
+///
+/// A graph is not oriented when each of its edges can be paired with an edge in the opposite direction,
+/// i.e. when the successors of each vertex are also its predecessors, with the same multiplicities.
+/// Computed with the other cached properties, in O(V + E) once per version of the graph.
+/// An undirected graph is never oriented.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::isOriented()
 {
-    if (this->adjacencyList.size() >= 2)
+    if constexpr (!Direction::directed)
     {
-        T *vertex = this->adjacencyList.begin()->first;
+        return false;
+    }
+    this->refreshProperties();
+    return this->properties.oriented;
+}
 
-        std::list<T *> visited;
-        std::list<T *> toVisit;
+/// @brief Returns whether the graph is weighted
+/// @returns Whether the graph is weighted
+/// @author Damien Tschan
+/// @date 24.04.2023
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+bool Graph<T, W, Direction, EdgeAllocator>::isWeighted()
+{
+    this->refreshProperties();
+    return this->properties.weighted;
+}
 
-        toVisit.push_back(vertex);
+/// @brief Returns the degree statistics of the graph
+/// @returns The minimum and maximum degrees and the amount of unbalanced vertices
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+DegreeStatistics Graph<T, W, Direction, EdgeAllocator>::getDegreeStatistics()
+{
+    this->refreshProperties();
+    return this->properties.degreeStatistics;
+}
 
-        while (!toVisit.empty())
-        {
-            T *currentVertex = *toVisit.begin();
-            visited.push_back(currentVertex);
+/// @brief Returns the memory footprint of the graph, broken down by category
+/// @returns The bytes used by the vertex table, the adjacency containers, the edges, the indexes and the cache
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// O(V + E) when the incoming edge index is enabled, O(V) otherwise. See MemoryUsage for what is counted.
+/// Prebuilt edges are not counted, as they are not owned by the graph.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+MemoryUsage Graph<T, W, Direction, EdgeAllocator>::memoryUsage()
+{
+    MemoryUsage usage;
+    usage.vertexTable = vectorMemoryUsage(this->vertexTable) + vectorMemoryUsage(this->adjacencyById)
+                        + hashMemoryUsage(this->vertexIds) + vectorMemoryUsage(this->freeIds);
 
-            for (auto &adjacentVertex : this->adjacencyList[currentVertex])
-            {
-                bool notVisited = std::find(visited.begin(), visited.end(), adjacentVertex->getTarget()) == visited.end();
-                bool notEncountered = std::find(toVisit.begin(), toVisit.end(), adjacentVertex->getTarget()) == toVisit.end();
-                if (notVisited && notEncountered)
-                {
-                    toVisit.push_back(adjacentVertex->getTarget());
-                }
-            }
+    usage.adjacency = hashMemoryUsage(this->adjacencyList);
+    for (auto const &vertexPair : this->adjacencyList)
+    {
+        usage.adjacency += vertexPair.second.memoryUsage();
+    }
 
-            toVisit.remove(currentVertex);
-        }
+    usage.edges = this->edgeAllocator.memoryUsage();
 
-        return visited.size() == this->adjacencyList.size();
-    }
-    else
+    usage.incomingIndex = vectorMemoryUsage(this->incomingById);
+    for (auto const &incomingEdges : this->incomingById)
     {
-        return true;
+        usage.incomingIndex += vectorMemoryUsage(incomingEdges);
     }
-}
 
-/// @brief Returns whether the graph is strongly connected
-/// @returns Whether the graph is strongly connected
-/// @author Damien Tschan
-/// @date 24.04.2023
-template <typename T>
-bool Graph<T>::isStronglyConnected()
-{
-    return this->getNbVertices() * log2(this->getNbVertices()) < this->getNbEdges();
+    usage.edgeIndex = hashMemoryUsage(this->edgesByEnds);
+    usage.cache = vectorMemoryUsage(this->properties.indegrees);
+    return usage;
 }
 
-/// @brief Returns whether the graph is oriented
-/// @returns Whether the graph is oriented
-/// @author Damien Tschan
-/// @date 24.04.2023
-template <typename T>
-bool Graph<T>::isOriented()
+/// @brief Computes the cached structural properties, if the graph was modified since they were last computed
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Single O(V + E) pass : the indegrees are counted, then the predecessors of each vertex are bucketed
+/// so that they can be compared to its successors with a per-vertex balance array.
+/// An undirected graph only needs a pass over the edges for the weights, its degrees are known from the incoming edge index.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+void Graph<T, W, Direction, EdgeAllocator>::refreshProperties()
 {
-    std::list<std::pair<bool,std::pair<T*,T*>>> edgeList;
-    for (auto & vertex : this->adjacencyList)
+    if (this->properties.version == this->version)
     {
-        for(auto const& edge : vertex.second)
-        {
-            edgeList.push_back(std::make_pair(false, std::make_pair(vertex.first, edge->getTarget())));
-        }
+        return;
     }
-    for (auto & edge1 : edgeList)
+    uint32_t bound = this->getVertexIdBound();
+    Properties &cache = this->properties;
+    cache.oriented = false;
+    cache.weighted = false;
+    cache.indegrees.assign(bound, 0);
+
+    if constexpr (!Direction::directed)
     {
-        if(edge1.first == false)
+        DegreeStatistics &statistics = cache.degreeStatistics;
+        statistics = DegreeStatistics();
+        bool first = true;
+        for (uint32_t id = 0; id < bound; id++)
         {
-            for (auto & edge2 : edgeList)
+            if (this->getVertex(id) == nullptr)
             {
-                if(edge2.first == false)
-                {
-                    if(edge1.second.first == edge2.second.second && edge2.second.first == edge1.second.second)
-                    {
-                        edge1.first = true;
-                        edge2.first = true;
-                    }
-                }
+                continue;
+            }
+            for (Edge<T, W> *edge : this->getEdges(id))
+            {
+                cache.weighted = cache.weighted || edge->getWeight() != 1;
             }
+            int degree = this->getVertexOutdegree(id);
+            cache.indegrees[id] = degree;
+            statistics.minIndegree = statistics.minOutdegree = first ? degree : std::min(statistics.minIndegree, degree);
+            statistics.maxIndegree = statistics.maxOutdegree = first ? degree : std::max(statistics.maxIndegree, degree);
+            first = false;
         }
+        cache.version = this->version;
+        return;
     }
-    bool oriented = false;
-    for (auto const& edge : edgeList)
+
+    // Indegrees and weights
+    for (uint32_t id = 0; id < bound; id++)
     {
-        if(edge.first == false)
+        if (this->getVertex(id) == nullptr)
+        {
+            continue;
+        }
+        for (Edge<T, W> *edge : this->getEdges(id))
         {
-            oriented = true;
+            uint32_t targetId = this->getTargetId(edge);
+            if (targetId == NO_VERTEX)
+            {
+                cache.oriented = true; // an edge towards a vertex out of the graph cannot be paired
+            }
+            else
+            {
+                cache.indegrees[targetId]++;
+            }
+            if (edge->getWeight() != 1)
+            {
+                cache.weighted = true;
+            }
         }
     }
-    return oriented;
-}
 
-/// @brief Returns whether the graph is weighted
-/// @returns Whether the graph is weighted
-/// @author Damien Tschan
-/// @date 24.04.2023
-template <typename T>
-bool Graph<T>::isWeighted()
-{
-    bool isWeighted = false;
-    for (auto const &vertex : this->adjacencyList)
+    // Predecessors of each vertex, bucketed by target
+    std::vector<uint32_t> offsets(bound + 1, 0);
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        offsets[id + 1] = offsets[id] + cache.indegrees[id];
+    }
+    std::vector<uint32_t> predecessors(offsets[bound]);
     {
-        for (auto const &edge : vertex.second)
+        std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+        for (uint32_t id = 0; id < bound; id++)
         {
-            if (edge->getWeight() != 1)
+            if (this->getVertex(id) == nullptr)
+            {
+                continue;
+            }
+            for (Edge<T, W> *edge : this->getEdges(id))
             {
-                isWeighted = true;
+                uint32_t targetId = this->getTargetId(edge);
+                if (targetId != NO_VERTEX)
+                {
+                    predecessors[next[targetId]++] = id;
+                }
             }
         }
     }
-    return isWeighted;
+
+    // Orientation and degree statistics
+    DegreeStatistics &statistics = cache.degreeStatistics;
+    statistics = DegreeStatistics();
+    std::vector<int> balance(bound, 0);
+    bool first = true;
+    for (uint32_t id = 0; id < bound; id++)
+    {
+        if (this->getVertex(id) == nullptr)
+        {
+            continue;
+        }
+        int indegree = cache.indegrees[id];
+        int outdegree = this->getEdges(id).size();
+        statistics.minIndegree = first ? indegree : std::min(statistics.minIndegree, indegree);
+        statistics.maxIndegree = first ? indegree : std::max(statistics.maxIndegree, indegree);
+        statistics.minOutdegree = first ? outdegree : std::min(statistics.minOutdegree, outdegree);
+        statistics.maxOutdegree = first ? outdegree : std::max(statistics.maxOutdegree, outdegree);
+        statistics.nbUnbalancedVertices += indegree != outdegree;
+        first = false;
+
+        if (cache.oriented)
+        {
+            continue;
+        }
+        for (Edge<T, W> *edge : this->getEdges(id))
+        {
+            balance[this->getTargetId(edge)]++;
+        }
+        for (uint32_t i = offsets[id]; i < offsets[id + 1]; i++)
+        {
+            balance[predecessors[i]]--;
+        }
+        for (Edge<T, W> *edge : this->getEdges(id))
+        {
+            cache.oriented = cache.oriented || balance[this->getTargetId(edge)] != 0;
+            balance[this->getTargetId(edge)] = 0;
+        }
+        for (uint32_t i = offsets[id]; i < offsets[id + 1]; i++)
+        {
+            cache.oriented = cache.oriented || balance[predecessors[i]] != 0;
+            balance[predecessors[i]] = 0;
+        }
+    }
+    cache.version = this->version;
 }
 
 /// @brief Returns an estimation of the chromatic number of the graph as an integer
@@ -887,59 +2734,66 @@ bool Graph<T>::isWeighted()
 /// This method uses the greedy algorithm, where each vertex is colored one after the other
 /// with the first possible color. This method can perform well depending on the order in which
 /// the vertices are colored, and depends on the shape of the graph. In this implementation,
-/// vertices are colored in order of descending degree.
-template <typename T>
-int Graph<T>::getChromaticNumber()
+/// vertices are colored in order of descending degree (indegree + outdegree).
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+int Graph<T, W, Direction, EdgeAllocator>::getChromaticNumber()
 {
 
     // SORTING THE VERTICES
-    // Declare vector of pairs
-    std::vector<std::pair<T *, std::list<Edge<T> *>>> verticesOrderedByDegree;
-
-    // Copy key-value pair from Map
-    // to vector of pairs
-    for (auto &it : this->adjacencyList)
+    // Degrees are computed once, in a single pass over the edges, in an array indexed by vertex id
+    std::vector<int> degrees(this->getVertexIdBound(), 0);
+    std::vector<uint32_t> verticesOrderedByDegree;
+    verticesOrderedByDegree.reserve(this->adjacencyList.size());
+    for (uint32_t id = 0; id < this->getVertexIdBound(); id++)
     {
-        verticesOrderedByDegree.push_back(it);
+        if (this->getVertex(id) != nullptr)
+        {
+            verticesOrderedByDegree.push_back(id);
+            degrees[id] += this->getEdges(id).size();
+            for (Edge<T, W> *edge : this->getEdges(id))
+            {
+                uint32_t targetId = this->getTargetId(edge);
+                if (targetId != NO_VERTEX)
+                {
+                    degrees[targetId]++;
+                }
+            }
+        }
     }
 
     // Sort using comparator function
-    sort(verticesOrderedByDegree.begin(), verticesOrderedByDegree.end(), [this](std::pair<T *, std::list<Edge<T> *>> a, std::pair<T *, std::list<Edge<T> *>> b)
-         {
-        int aDegree = this->getVertexIndegree(a.first) + this->getVertexIndegree(a.first);
-        int bDegree = this->getVertexIndegree(b.first) + this->getVertexIndegree(b.first);
-        return aDegree < bDegree; });
+    std::stable_sort(verticesOrderedByDegree.begin(), verticesOrderedByDegree.end(), [&degrees](uint32_t a, uint32_t b)
+                     { return degrees[a] > degrees[b]; });
 
     // COLORING THE VERTICES
-    // A map of pairs vertex <-> color
-    // Colors are simply represented by an integer
-    std::unordered_map<T *, int> colorMap;
+    // An array of colors indexed by vertex id
+    // Colors are simply represented by an integer, 0 meaning that the vertex is not colored yet
+    std::vector<int> colorMap(this->getVertexIdBound(), 0);
     // Function to check if a vertex can be assigned a given color
-    auto canAssignColor = [&](T *vertex, int color)
+    auto canAssignColor = [&](uint32_t vertex, int color)
     {
-        for (auto &adjacentVertex : this->adjacencyList[vertex])
+        bool available = true;
+        this->forEachNeighbour(vertex, [&](uint32_t neighbourId, Edge<T, W> *)
         {
-            if (colorMap[adjacentVertex->getTarget()] == color)
-            {
-                return false;
-            }
-        }
-        return true;
+            // A prebuilt edge may lead out of the graph, to a vertex which is never colored
+            available = available && (neighbourId == NO_VERTEX || colorMap[neighbourId] != color);
+        });
+        return available;
     };
 
     int numVertices = this->getNbVertices();
     int chromaticNumber = 0;
 
     // Try to assign colors from 1 to max. number of colors
-    for (auto const &vertexStruct : verticesOrderedByDegree)
+    for (uint32_t vertex : verticesOrderedByDegree)
     {
         int colorNum = 1;
         while (colorNum <= numVertices)
         {
-            if (canAssignColor(vertexStruct.first, colorNum))
+            if (canAssignColor(vertex, colorNum))
             {
                 // Assign a color
-                colorMap[vertexStruct.first] = colorNum;
+                colorMap[vertex] = colorNum;
                 chromaticNumber = colorNum > chromaticNumber ? colorNum : chromaticNumber;
                 break;
             }
@@ -958,27 +2812,26 @@ int Graph<T>::getChromaticNumber()
 /// @returns The amount of edges in the graph as an integer
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T>
-int Graph<T>::getNbEdges()
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+int Graph<T, W, Direction, EdgeAllocator>::getNbEdges()
 {
-    int sizeSum = 0;
-    for (auto const &vertex : this->adjacencyList)
+    if constexpr (!Direction::directed)
     {
-        sizeSum += vertex.second.size();
+        return this->nbArcs;
     }
     if (!this->isOriented())
     {
-        sizeSum /= 2;
+        return this->nbArcs / 2;
     }
-    return sizeSum;
+    return this->nbArcs;
 }
 
 /// @brief Returns the amount of vertices in the graph as an integer
 /// @returns The amount of vertices in the graph as an integer
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T>
-int Graph<T>::getNbVertices()
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+int Graph<T, W, Direction, EdgeAllocator>::getNbVertices()
 {
     return this->adjacencyList.size();
 }
@@ -988,24 +2841,39 @@ int Graph<T>::getNbVertices()
 /// @returns The indegree of the vertex
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T>
-int Graph<T>::getVertexIndegree(T *vertex)
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+int Graph<T, W, Direction, EdgeAllocator>::getVertexIndegree(T *vertex)
+{
+    uint32_t id = this->getVertexId(vertex);
+    return id == NO_VERTEX ? 0 : this->getVertexIndegree(id);
+}
+
+/// @brief Returns the indegree of a vertex
+/// @param id A vertex id
+/// @returns The indegree of the vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// O(1) with the incoming edge index, otherwise read from the cached properties,
+/// which costs a pass over every edge after each modification of the graph.
+/// On an undirected graph, the indegree and the outdegree are both the degree of the vertex.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+int Graph<T, W, Direction, EdgeAllocator>::getVertexIndegree(uint32_t id)
 {
-    int indegree = 0;
-    if (this->adjacencyList.find(vertex) != this->adjacencyList.end())
+    if (this->getVertex(id) == nullptr)
     {
-        for (auto const &otherVertex : this->adjacencyList)
-        {
-            for (auto const &edgeFromOtherVertex : this->adjacencyList[otherVertex.first])
-            {
-                if (edgeFromOtherVertex->getTarget() == vertex)
-                {
-                    indegree++;
-                }
-            }
-        }
+        return 0;
+    }
+    if constexpr (!Direction::directed)
+    {
+        return this->getVertexOutdegree(id);
     }
-    return indegree;
+    if (this->incomingIndexEnabled)
+    {
+        return this->incomingById[id].size();
+    }
+    this->refreshProperties();
+    return this->properties.indegrees[id];
 }
 
 /// @brief Returns the outdegree of a vertex
@@ -1013,212 +2881,399 @@ int Graph<T>::getVertexIndegree(T *vertex)
 /// @returns The outdegree of the vertex
 /// @author Damien Tschan
 /// @date 17.04.2023
-template <typename T>
-int Graph<T>::getVertexOutdegree(T *vertex)
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+int Graph<T, W, Direction, EdgeAllocator>::getVertexOutdegree(T *vertex)
+{
+    uint32_t id = this->getVertexId(vertex);
+    return id == NO_VERTEX ? 0 : this->getVertexOutdegree(id);
+}
+
+/// @brief Returns the outdegree of a vertex
+/// @param id A vertex id
+/// @returns The outdegree of the vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// On an undirected graph, the edges stored by the neighbours count as well, so a loop counts twice.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+int Graph<T, W, Direction, EdgeAllocator>::getVertexOutdegree(uint32_t id)
 {
-    if (this->adjacencyList.find(vertex) != this->adjacencyList.end())
+    if (this->getVertex(id) != nullptr)
     {
-        return this->adjacencyList[vertex].size();
+        if constexpr (!Direction::directed)
+        {
+            return this->getEdges(id).size() + this->incomingById[id].size();
+        }
+        return this->getEdges(id).size();
     }
     return 0;
 }
 
-/// @brief Returns a new graph which is a minimum spanning tree of the initial graph.
+/// @brief Returns the edges of a minimum spanning tree of the initial graph.
+/// @returns The edges of the tree, in the order they were added to it
 ///
-/// This method uses Prim's algorithm.
+/// This method uses Prim's algorithm, starting from the first vertex of the adjacency list :
+/// on a graph which is not connected, the tree only spans the vertices reachable from it.
 /// @author Jonas Flückiger
 /// @date 15.05.2023
-template <typename T>
-Graph<T> *Graph<T>::getMinimumSpanningTree()
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+std::vector<Edge<T, W> *> Graph<T, W, Direction, EdgeAllocator>::getMinimumSpanningTreeEdges()
 {
-    Graph<T> *msTree = new Graph<T>();
+    std::vector<Edge<T, W> *> treeEdges;
+    if (this->isEmpty())
+    {
+        return treeEdges;
+    }
 
     // This method uses a standard library priority queue. Because this implementation does not allow
     // priority updates, we must check if each element we pop is the most up-to-date one
     // see https://stackoverflow.com/questions/649640/how-to-do-an-efficient-priority-update-in-stl-priority-queue
-    auto cmp = [](queue_element<T> left, queue_element<T> right)
-    { return left.priority > right.priority; };
-    std::unordered_map<T *, int> upToDatePrios = std::unordered_map<T *, int>();
-    std::priority_queue<queue_element<T>, std::vector<queue_element<T>>, decltype(cmp)> toVisit(cmp);
+    // Per-vertex state is kept in arrays indexed by vertex id, the maximum weight meaning that the vertex was not encountered yet
+    // On unweighted graphs, the queue is a FIFO one and the algorithm is a breadth-first search
+    std::vector<Weight> upToDatePrios(this->getVertexIdBound(), std::numeric_limits<Weight>::max());
+    std::vector<bool> visited(this->getVertexIdBound(), false);
+    search_queue<T, W> toVisit;
 
     // Add first vertex and its edges
-    msTree->addVertex(this->adjacencyList.begin()->first);
-    for (Edge<T> *&edge : this->adjacencyList.begin()->second)
+    T *firstVertex = this->adjacencyList.begin()->first;
+    uint32_t firstVertexId = this->getVertexId(firstVertex);
+    visited[firstVertexId] = true;
+    this->forEachNeighbour(firstVertexId, [&](uint32_t targetId, Edge<T, W> *edge)
     {
-        toVisit.push(queue_element<T>(edge->getWeight(), this->adjacencyList.begin()->first, edge));
-        upToDatePrios.insert(std::make_pair(edge->getTarget(), edge->getWeight()));
-    }
+        if (targetId == NO_VERTEX)
+        {
+            return; // a prebuilt edge leading out of the graph
+        }
+        toVisit.push(queue_element<T, W>(edge->getWeight(), firstVertexId, edge, targetId));
+        upToDatePrios[targetId] = std::min(upToDatePrios[targetId], edge->getWeight());
+    });
     while (!toVisit.empty())
     {
         // Get the top element
-        queue_element<T> top = toVisit.top();
-        toVisit.pop();
+        queue_element<T, W> top = toVisit.pop();
 
         // Ignore out-of-date elements
-        bool visited = msTree->adjacencyList.find(top.edge->getTarget()) != msTree->adjacencyList.end();
-        if (visited || top.priority > upToDatePrios[top.edge->getTarget()])
+        uint32_t topId = top.targetId;
+        if (visited[topId] || top.priority > upToDatePrios[topId])
         {
             continue;
         }
 
-        // Visit the vertex and add it to the tree
-        msTree->addVertex(top.edge->getTarget());
-        msTree->addPrebuiltEdge(top.source, top.edge);
-        if (!this->isOriented())
-        {
-            auto hasSourceAsTarget = [&top](Edge<T> *edge)
-            {
-                return edge->getTarget() == top.source;
-            };
+        // Visit the vertex and add its edge to the tree
+        visited[topId] = true;
+        treeEdges.push_back(top.edge);
 
-            // Find corresponding edge
-            Edge<T> *reverseEdge = nullptr;
-            for (auto const &edge : this->adjacencyList[top.edge->getTarget()])
+        // Add all its neighbour and update edges weight
+        this->forEachNeighbour(topId, [&](uint32_t targetId, Edge<T, W> *edge)
+        {
+            if (targetId == NO_VERTEX)
             {
-                if (hasSourceAsTarget(edge))
-                {
-                    reverseEdge = edge;
-                    continue;
-                }
+                return; // a prebuilt edge leading out of the graph
             }
-
-            // Add the reverse path
-            if (reverseEdge != nullptr)
+            // Check if next vertex was already visited, and if it was encountered, that the new prio is smaller
+            if (!visited[targetId] && edge->getWeight() < upToDatePrios[targetId])
             {
-                msTree->addPrebuiltEdge(top.edge->getTarget(), reverseEdge);
+                upToDatePrios[targetId] = edge->getWeight();
+                toVisit.push(queue_element<T, W>(edge->getWeight(), topId, edge, targetId));
             }
-        }
+        });
+    }
+    return treeEdges;
+}
 
-        // Add all its neighbour and update edges weight
-        for (Edge<T> *&edge : this->adjacencyList[top.edge->getTarget()])
-        {
-            // Check if next vertex was already visited
-            bool notVisited = msTree->adjacencyList.find(edge->getTarget()) == msTree->adjacencyList.end();
-            if (notVisited)
-            {
-                // Check if the next vertex wasnt already encountered and if it was, that the new prio is smaller
-                if (upToDatePrios.find(edge->getTarget()) == upToDatePrios.end())
-                {
-                    upToDatePrios.insert(std::make_pair(edge->getTarget(), edge->getWeight()));
-                }
-                else if (edge->getWeight() < upToDatePrios[edge->getTarget()])
-                {
-                    upToDatePrios.erase(edge->getTarget());
-                    upToDatePrios.insert(std::make_pair(edge->getTarget(), edge->getWeight()));
-                }
-                toVisit.push(queue_element<T>(edge->getWeight(), top.edge->getTarget(), edge));
-            }
-        }
+/// @brief Returns the shortest paths from a vertex to every vertex of the graph.
+/// @param startingVertex The starting vertex
+/// @returns The shortest paths, with no starting vertex if it is not in the graph
+/// @author Jonas Flückiger
+/// @date 26.05.2023
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+ShortestPaths<T, W> Graph<T, W, Direction, EdgeAllocator>::getShortestPaths(T *startingVertex)
+{
+    uint32_t startingVertexId = this->getVertexId(startingVertex);
+    if (startingVertexId == NO_VERTEX)
+    {
+        return ShortestPaths<T, W>();
     }
-    return msTree;
+    return this->getShortestPaths(startingVertexId);
 }
 
-/// @brief Returns a new graph which is the shortest paths graph of the initial graph.
+/// @brief Returns the shortest paths from a vertex to every vertex of the graph.
+/// @param startingVertexId The id of the starting vertex
+/// @returns The shortest paths, indexed by vertex id
 ///
-/// This method uses Dijkstra's algorithm.
+/// This method uses Dijkstra's algorithm, whose per-vertex state is directly the result.
 /// @author Jonas Flückiger
 /// @date 26.05.2023
-template <typename T>
-Graph<T> *Graph<T>::getMinimumDistanceGraph(T *startingVertex)
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+ShortestPaths<T, W> Graph<T, W, Direction, EdgeAllocator>::getShortestPaths(uint32_t startingVertexId)
 {
-    Graph<T> *mdGraph = new Graph<T>();
+    ShortestPaths<T, W> paths;
+    T *startingVertex = this->getVertex(startingVertexId);
+    if (startingVertex == nullptr)
+    {
+        return paths;
+    }
 
     // This method uses a standard library priority queue. Because this implementation does not allow
     // priority updates, we must check if each element we pop is the most up-to-date one
     // see https://stackoverflow.com/questions/649640/how-to-do-an-efficient-priority-update-in-stl-priority-queue
-    auto cmp = [](queue_element<T> left, queue_element<T> right)
-    { return left.priority > right.priority; };
-    std::unordered_map<T *, int> upToDatePrios = std::unordered_map<T *, int>();
-    std::priority_queue<queue_element<T>, std::vector<queue_element<T>>, decltype(cmp)> toVisit(cmp);
+    // The distances are the priorities, the maximum weight meaning that the vertex was not encountered yet
+    // On unweighted graphs, the queue is a FIFO one and the algorithm is a breadth-first search
+    paths.startingVertexId = startingVertexId;
+    paths.distances.assign(this->getVertexIdBound(), ShortestPaths<T, W>::UNREACHABLE);
+    paths.predecessors.assign(this->getVertexIdBound(), NO_VERTEX);
+    paths.predecessorEdges.assign(this->getVertexIdBound(), nullptr);
+    std::vector<Weight> &upToDatePrios = paths.distances;
+    std::vector<bool> visited(this->getVertexIdBound(), false);
+    search_queue<T, W> toVisit;
 
     // Add first vertex and its edges
-    mdGraph->addVertex(startingVertex);
-    for (Edge<T> *&edge : this->adjacencyList[startingVertex])
+    upToDatePrios[startingVertexId] = 0;
+    visited[startingVertexId] = true;
+    this->forEachNeighbour(startingVertexId, [&](uint32_t targetId, Edge<T, W> *edge)
     {
-        toVisit.push(queue_element<T>(edge->getWeight(), startingVertex, edge));
-        upToDatePrios.insert(std::make_pair(edge->getTarget(), edge->getWeight()));
-    }
+        if (targetId == NO_VERTEX)
+        {
+            return; // a prebuilt edge leading out of the graph
+        }
+        toVisit.push(queue_element<T, W>(edge->getWeight(), startingVertexId, edge, targetId));
+        upToDatePrios[targetId] = std::min(upToDatePrios[targetId], edge->getWeight());
+    });
     while (!toVisit.empty())
     {
         // Get the top element
-        queue_element<T> top = toVisit.top();
-        toVisit.pop();
+        queue_element<T, W> top = toVisit.pop();
 
         // Ignore out-of-date elements
-        bool visited = mdGraph->adjacencyList.find(top.edge->getTarget()) != mdGraph->adjacencyList.end();
-        if (visited || top.priority > upToDatePrios[top.edge->getTarget()])
+        uint32_t topId = top.targetId;
+        if (visited[topId] || top.priority > upToDatePrios[topId])
         {
             continue;
         }
 
-        // Visit the vertex and add it to the tree
-        mdGraph->addVertex(top.edge->getTarget());
-        mdGraph->addPrebuiltEdge(top.source, top.edge);
-        if (!this->isOriented())
+        // Visit the vertex and record how it was reached
+        visited[topId] = true;
+        paths.predecessors[topId] = top.sourceId;
+        paths.predecessorEdges[topId] = top.edge;
+
+        // Add all its neighbour and update edges weight
+        this->forEachNeighbour(topId, [&](uint32_t targetId, Edge<T, W> *edge)
         {
-            auto hasSourceAsTarget = [&top](Edge<T> *edge)
+            if (targetId == NO_VERTEX)
             {
-                return edge->getTarget() == top.source;
-            };
-
-            // Find corresponding edge
-            Edge<T> *reverseEdge = nullptr;
-            for (auto const &edge : this->adjacencyList[top.edge->getTarget()])
+                return; // a prebuilt edge leading out of the graph
+            }
+            // Check if next vertex was already visited, and if it was encountered, that the new prio is smaller
+            if (!visited[targetId] && top.priority + edge->getWeight() < upToDatePrios[targetId])
             {
-                if (hasSourceAsTarget(edge))
-                {
-                    reverseEdge = edge;
-                    continue;
-                }
+                upToDatePrios[targetId] = top.priority + edge->getWeight();
+                toVisit.push(queue_element<T, W>(top.priority + edge->getWeight(), topId, edge, targetId));
             }
+        });
+    }
+    return paths;
+}
 
-            // Add the reverse path
+/// @brief Returns a new graph made of some edges of the graph and of their end vertices
+/// @param edges The edges, such as the result of getMinimumSpanningTreeEdges() or ShortestPaths::getTreeEdges()
+/// @param withReverseEdges Whether the reverse of each edge is added too, when it exists, on a directed graph
+/// @returns The subgraph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The subgraph shares its vertices and edges with the graph without owning them : deleting it leaves them untouched,
+/// and it must not outlive the graph.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator> *Graph<T, W, Direction, EdgeAllocator>::getSubgraph(const std::vector<Edge<T, W> *> &edges, bool withReverseEdges)
+{
+    Graph<T, W, Direction, EdgeAllocator> *subgraph = new Graph<T, W, Direction, EdgeAllocator>();
+    subgraph->ownsVertices = false;
+    for (Edge<T, W> *edge : edges)
+    {
+        subgraph->addVertex(edge->getSource());
+        subgraph->addVertex(edge->getTarget());
+        subgraph->addPrebuiltEdge(edge->getSource(), edge);
+        if constexpr (Direction::directed)
+        {
+            Edge<T, W> *reverseEdge = withReverseEdges ? this->getReverseEdge(this->getVertexId(edge->getSource()), edge) : nullptr;
             if (reverseEdge != nullptr)
             {
-                mdGraph->addPrebuiltEdge(top.edge->getTarget(), reverseEdge);
+                subgraph->addPrebuiltEdge(edge->getTarget(), reverseEdge);
             }
         }
+    }
+    return subgraph;
+}
 
-        // Add all its neighbour and update edges weight
-        for (Edge<T> *&edge : this->adjacencyList[top.edge->getTarget()])
+/// @brief Returns a new graph which is a minimum spanning tree of the initial graph.
+///
+/// The tree is the one of getMinimumSpanningTreeEdges(). On a directed graph which is not oriented,
+/// the reverse of each edge is added too, so that the tree is not oriented either.
+/// The tree shares its vertices and edges with the graph without owning them, and must not outlive it.
+/// @author Jonas Flückiger
+/// @date 15.05.2023
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator> *Graph<T, W, Direction, EdgeAllocator>::getMinimumSpanningTree()
+{
+    Graph<T, W, Direction, EdgeAllocator> *msTree = this->getSubgraph(this->getMinimumSpanningTreeEdges(), !this->isOriented());
+    if (!this->isEmpty())
+    {
+        msTree->addVertex(this->adjacencyList.begin()->first);
+    }
+    return msTree;
+}
+
+/// @brief Returns a new graph which is the shortest paths graph of the initial graph.
+///
+/// The graph is made of the edges of the shortest paths tree of getShortestPaths(). On a directed graph which is not oriented,
+/// the reverse of each edge is added too.
+/// The graph shares its vertices and edges with the initial graph without owning them, and must not outlive it.
+/// @author Jonas Flückiger
+/// @date 26.05.2023
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator> *Graph<T, W, Direction, EdgeAllocator>::getMinimumDistanceGraph(T *startingVertex)
+{
+    uint32_t startingVertexId = this->getVertexId(startingVertex);
+    if (startingVertexId == NO_VERTEX)
+    {
+        return this->getSubgraph({});
+    }
+    return this->getMinimumDistanceGraph(startingVertexId);
+}
+
+/// @brief Returns a new graph which is the shortest paths graph of the initial graph.
+/// @param startingVertexId The id of the starting vertex
+///
+/// See getMinimumDistanceGraph(T *).
+/// @author Jonas Flückiger
+/// @date 26.05.2023
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator> *Graph<T, W, Direction, EdgeAllocator>::getMinimumDistanceGraph(uint32_t startingVertexId)
+{
+    Graph<T, W, Direction, EdgeAllocator> *mdGraph = this->getSubgraph(this->getShortestPaths(startingVertexId).getTreeEdges(), !this->isOriented());
+    if (this->getVertex(startingVertexId) != nullptr)
+    {
+        mdGraph->addVertex(this->getVertex(startingVertexId));
+    }
+    return mdGraph;
+}
+
+/// @brief Returns the hamiltonian path of a graph
+/// @returns A subgraph containing all the vertices and the hamiltonian path if it exists, an empty graph otherwise
+///
+/// The path is the one of getHamiltonianPathEdges().
+/// The subgraph shares its vertices and edges with the graph without owning them, and must not outlive it.
+/// @author Damien Tschan
+/// @date 09.06.2023
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+Graph<T, W, Direction, EdgeAllocator> *Graph<T, W, Direction, EdgeAllocator>::getHamiltonianPath()
+{
+    std::vector<Edge<T, W> *> path = this->getHamiltonianPathEdges();
+    Graph<T, W, Direction, EdgeAllocator> *returnGraph = this->getSubgraph(path);
+    if (!path.empty())
+    {
+        for (auto const &vertexAdjList : this->adjacencyList)
+        {
+            returnGraph->addVertex(vertexAdjList.first);
+        }
+    }
+    return returnGraph;
+}
+
+/// @brief Builds an immutable compressed-sparse-row snapshot of the graph for analysis workloads
+/// @returns The snapshot, whose vertex and edge ids map back to the vertices and edges of the graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Vertex ids follow the iteration order of the adjacency list, so the vertex 0 of the snapshot
+/// is the vertex from which the algorithms of the graph start.
+/// The snapshot is not updated when the graph is modified.
+/// The snapshot of an undirected graph has an arc in each direction for every edge, except the loops.
+/// The prebuilt edges leading out of the graph are left out.
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+CompactGraph<T, W> Graph<T, W, Direction, EdgeAllocator>::freeze()
+{
+    std::vector<T *> vertices;
+    vertices.reserve(this->adjacencyList.size());
+    std::unordered_map<T *, uint32_t> ids;
+    ids.reserve(this->adjacencyList.size());
+    size_t nbArcs = 0;
+    for (auto const &vertexPair : this->adjacencyList)
+    {
+        ids.insert(std::make_pair(vertexPair.first, (uint32_t)vertices.size()));
+        vertices.push_back(vertexPair.first);
+        nbArcs += vertexPair.second.size();
+    }
+    if (!Direction::directed)
+    {
+        nbArcs *= 2;
+    }
+
+    std::vector<uint32_t> offsets;
+    offsets.reserve(vertices.size() + 1);
+    std::vector<uint32_t> targets;
+    targets.reserve(nbArcs);
+    std::vector<Weight> weights;
+    if (WeightTraits<W>::weighted)
+    {
+        weights.reserve(nbArcs);
+    }
+    std::vector<Edge<T, W> *> edges;
+    edges.reserve(nbArcs);
+    for (T *vertex : vertices)
+    {
+        offsets.push_back(targets.size());
+        for (Edge<T, W> *edge : this->adjacencyList[vertex])
         {
-            // Check if next vertex was already visited
-            bool notVisited = mdGraph->adjacencyList.find(edge->getTarget()) == mdGraph->adjacencyList.end();
-            if (notVisited)
+            auto target = ids.find(edge->getTarget());
+            if (target == ids.end())
             {
-                // Check if the next vertex wasnt already encountered and if it was, that the new prio is smaller
-                if (upToDatePrios.find(edge->getTarget()) == upToDatePrios.end())
-                {
-                    upToDatePrios.insert(std::make_pair(edge->getTarget(), top.priority + edge->getWeight()));
-                }
-                else if (top.priority + edge->getWeight() < upToDatePrios[edge->getTarget()])
+                continue;
+            }
+            targets.push_back(target->second);
+            if (WeightTraits<W>::weighted)
+            {
+                weights.push_back(edge->getWeight());
+            }
+            edges.push_back(edge);
+        }
+        if constexpr (!Direction::directed)
+        {
+            uint32_t id = this->getVertexId(vertex);
+            for (auto const &incomingEdge : this->incomingById[id])
+            {
+                if (incomingEdge.first != id)
                 {
-                    upToDatePrios.erase(edge->getTarget());
-                    upToDatePrios.insert(std::make_pair(edge->getTarget(), top.priority + edge->getWeight()));
+                    targets.push_back(ids[this->getVertex(incomingEdge.first)]);
+                    if (WeightTraits<W>::weighted)
+                    {
+                        weights.push_back(incomingEdge.second->getWeight());
+                    }
+                    edges.push_back(incomingEdge.second);
                 }
-                upToDatePrios.insert(std::make_pair(edge->getTarget(), top.priority + edge->getWeight()));
-                toVisit.push(queue_element<T>(top.priority + edge->getWeight(), top.edge->getTarget(), edge));
             }
         }
     }
-    return mdGraph;
+    offsets.push_back(targets.size());
+
+    return CompactGraph<T, W>(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights), std::move(edges));
 }
 
 /// @brief Serializes a graph into the DOT format.
 ///
 /// @author Jonas Flückiger
 /// @date 26.05.2023
-template <typename T>
-std::string Graph<T>::exportToDOT()
+template <typename T, typename W, typename Direction, typename EdgeAllocator>
+std::string Graph<T, W, Direction, EdgeAllocator>::exportToDOT()
 {
     std::ostringstream os;
-    os << "digraph {" << std::endl;
+    os << (Direction::directed ? "digraph {" : "graph {") << std::endl;
     for (auto &vertexPair : this->adjacencyList)
     {
         for (auto &edge : vertexPair.second)
         {
             os << '"' << vertexPair.first << '"';
-            os << " -> ";
+            os << (Direction::directed ? " -> " : " -- ");
             os << '"' << edge->getTarget() << '"';
             os << " [weight=";
             os << edge->getWeight();
@@ -0,0 +1,689 @@
+#ifndef HAMILTONIAN_SEARCH_H
+#define HAMILTONIAN_SEARCH_H
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include "csr_view.h"
+
+/// @brief Outcome of a hamiltonian search, see HamiltonianSearch
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+enum class HamiltonianStatus
+{
+    /// @brief A hamiltonian circuit or path was found
+    Found,
+    /// @brief The whole search space was explored : there is no hamiltonian circuit or path
+    None,
+    /// @brief The search ran out of time or was cancelled before reaching a conclusion
+    Interrupted
+};
+
+/// @brief Result of a hamiltonian search, see HamiltonianSearch
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+struct HamiltonianSearchResult
+{
+    /// @brief Whether a circuit or path was found, proved not to exist, or neither
+    HamiltonianStatus status = HamiltonianStatus::None;
+    /// @brief The edge ids of the circuit or path in the order they are followed, empty unless one was found
+    std::vector<uint32_t> edgeIds;
+};
+
+/// @brief Branch-and-bound search for hamiltonian circuits and paths over a CSR view
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Each edge is undecided, required or deleted. The search picks an undecided edge at the most constrained vertex,
+/// requires it, and deletes it once every circuit requiring it has been ruled out. After each decision,
+/// the deduction and failure rules of Rubin (1974) are applied until none of them changes anything :
+///
+/// - R1, R2 : a vertex with as many edges left as it needs (one entering and one leaving, or two) requires them all ;
+/// - D1, D2 : a vertex with all the required edges it needs has its undecided edges deleted ;
+/// - D3 : an edge closing a chain of required edges is deleted, unless the chain goes through every vertex ;
+/// - F1 to F5 : the search backtracks when a vertex has too few edges left or too many required ones ;
+/// - F6 : the search backtracks when the required edges close a circuit missing some vertices.
+///
+/// The chains of required edges are known by their ends, so D3 and F6 cost O(degree) per required edge.
+/// The direction assignment rules A1 and A2 apply to graphs mixing directed and undirected edges : here a graph
+/// is either symmetric and searched as undirected, or searched arc by arc, D3 then deleting the reverse of each
+/// required arc, which is the deletion A1 leads to.
+///
+/// The state is held in flat arrays and the changes made since each decision are logged,
+/// so that backtracking undoes them instead of copying the state at each step.
+/// The search stays exponential in the worst case, but the rules settle most sparse graphs of a few hundred vertices
+/// quickly. It can be bounded by a time limit and interrupted from another thread through a cancellation flag.
+///
+/// The view is symmetric if it holds an arc in each direction for every edge, as the snapshot of an undirected graph does.
+/// Both arcs then stand for the same edge, so that a circuit must have at least 3 vertices.
+/// The engine refers to the view, which must outlive it. It can run any amount of searches, one at a time.
+template <typename W = int> class HamiltonianSearch
+{
+public:
+    explicit HamiltonianSearch(const CsrView<W> &graph, bool symmetric = false);
+
+    HamiltonianSearchResult findCircuit(std::chrono::milliseconds timeLimit = std::chrono::milliseconds::zero(),
+                                        const std::atomic<bool> *cancelled = nullptr);
+    HamiltonianSearchResult findPath(std::chrono::milliseconds timeLimit = std::chrono::milliseconds::zero(),
+                                     const std::atomic<bool> *cancelled = nullptr);
+
+private:
+    /// @brief Value used for an absent edge or vertex
+    static constexpr uint32_t NONE = UINT32_MAX;
+    /// @brief The amount of decisions between two checks of the clock and the cancellation flag
+    static constexpr uint32_t CHECK_PERIOD = 256;
+
+    enum EdgeState : uint8_t
+    {
+        Undecided,
+        Required,
+        Deleted
+    };
+
+    /// @brief A change to the chain ends, undone when backtracking
+    struct ChainChange
+    {
+        uint32_t vertex;
+        uint32_t otherEnd;
+        uint32_t size;
+    };
+
+    /// @brief A decision of the search, with the length of the logs before it was made
+    struct Decision
+    {
+        uint32_t edge;
+        size_t edgeLogSize;
+        size_t chainLogSize;
+        bool deleted;
+    };
+
+    HamiltonianSearchResult search(bool circuit, std::chrono::milliseconds timeLimit, const std::atomic<bool> *cancelled);
+    void build(bool withAdditionalVertex);
+    uint32_t getSlot(uint32_t edge, uint32_t end) const;
+    uint32_t getOtherEnd(uint32_t edge, uint32_t vertex) const;
+    bool require(uint32_t edge);
+    void remove(uint32_t edge);
+    bool propagate();
+    void undo(size_t edgeLogSize, size_t chainLogSize);
+    uint32_t chooseEdge() const;
+    std::vector<uint32_t> followCircuit(uint32_t startingVertex) const;
+
+    /// @brief The searched view
+    const CsrView<W> &graph;
+    /// @brief Whether each edge is held by an arc in each direction
+    bool symmetric;
+
+    /// @brief The amount of vertices searched, including the additional vertex of a path search
+    uint32_t nbVertices = 0;
+    /// @brief The additional vertex of a path search, linked both ways to every vertex, NONE for a circuit search
+    uint32_t additionalVertex = NONE;
+    /// @brief The amount of required edges of a vertex slot : 2 for undirected searches, 1 entering and 1 leaving otherwise
+    uint32_t needed = 2;
+    /// @brief The vertices of the edge `e` are ends[2e] and ends[2e + 1], from the tail to the head for directed searches
+    std::vector<uint32_t> ends;
+    /// @brief The arcs of the view followed along the edge `e` are arcIds[2e], from the first vertex to the second,
+    /// and arcIds[2e + 1] the other way, NONE for the edges of the additional vertex
+    std::vector<uint32_t> arcIds;
+    /// @brief The state of each edge
+    std::vector<EdgeState> states;
+    /// @brief The vertex `v` has the slots 2v, its leaving or incident edges, and 2v + 1, its entering edges for directed searches.
+    /// The edges of the slot `s` are the range [slotOffsets[s], slotOffsets[s + 1]) of slotEdges
+    std::vector<uint32_t> slotOffsets;
+    /// @brief The edges of each slot
+    std::vector<uint32_t> slotEdges;
+    /// @brief The amount of edges of each slot that are not deleted
+    std::vector<uint32_t> nbFree;
+    /// @brief The amount of required edges of each slot
+    std::vector<uint32_t> nbRequired;
+    /// @brief Maps the end of a chain of required edges to its other end, a vertex without required edges to itself
+    std::vector<uint32_t> otherEnd;
+    /// @brief The amount of vertices of the chain of each chain end
+    std::vector<uint32_t> chainSize;
+    /// @brief The amount of required edges
+    uint32_t nbRequiredEdges = 0;
+    /// @brief The edges decided since the search started, in order
+    std::vector<uint32_t> edgeLog;
+    /// @brief The chain ends changed since the search started, in order
+    std::vector<ChainChange> chainLog;
+    /// @brief The slots whose rules must be checked
+    std::vector<uint32_t> toCheck;
+};
+
+/// @brief Initializes the engine
+/// @param graph A CSR view, in memory or mapped
+/// @param symmetric Whether the view holds an arc in each direction for every edge, both standing for the same edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+HamiltonianSearch<W>::HamiltonianSearch(const CsrView<W> &graph, bool symmetric)
+    : graph(graph), symmetric(symmetric)
+{
+}
+
+/// @brief Searches a hamiltonian circuit, which goes through every vertex once and comes back to the first one
+/// @param timeLimit The time after which the search gives up, zero for no limit
+/// @param cancelled A flag set from another thread to stop the search, nullptr if it cannot be cancelled
+/// @returns The outcome, and the edge ids of the circuit in the order they are followed from the vertex 0 if one was found
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The circuit of a single vertex is one of its loops.
+template <typename W>
+HamiltonianSearchResult HamiltonianSearch<W>::findCircuit(std::chrono::milliseconds timeLimit, const std::atomic<bool> *cancelled)
+{
+    return this->search(true, timeLimit, cancelled);
+}
+
+/// @brief Searches a hamiltonian path, which goes through every vertex once
+/// @param timeLimit The time after which the search gives up, zero for no limit
+/// @param cancelled A flag set from another thread to stop the search, nullptr if it cannot be cancelled
+/// @returns The outcome, and the edge ids of the path in the order they are followed if one was found
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The path is searched as a circuit through an additional vertex linked both ways to every vertex.
+/// The path of a single vertex is found and has no edge.
+template <typename W>
+HamiltonianSearchResult HamiltonianSearch<W>::findPath(std::chrono::milliseconds timeLimit, const std::atomic<bool> *cancelled)
+{
+    return this->search(false, timeLimit, cancelled);
+}
+
+/// @brief Builds the edges and slots of a search
+/// @param withAdditionalVertex Whether to add a vertex linked both ways to every vertex of the view
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// Loops are left out, and so are the arcs of the view repeating an edge already built.
+template <typename W>
+void HamiltonianSearch<W>::build(bool withAdditionalVertex)
+{
+    uint32_t nbViewVertices = this->graph.getNbVertices();
+    this->nbVertices = nbViewVertices + (withAdditionalVertex ? 1 : 0);
+    this->additionalVertex = withAdditionalVertex ? nbViewVertices : NONE;
+    this->needed = this->symmetric ? 2 : 1;
+    this->ends.clear();
+    this->arcIds.clear();
+
+    // The edges of a symmetric view are built from their arc toward the higher id
+    std::vector<uint32_t> marks(nbViewVertices, NONE);
+    for (uint32_t id = 0; id < nbViewVertices; id++)
+    {
+        for (uint32_t e = this->graph.getFirstEdge(id); e < this->graph.getLastEdge(id); e++)
+        {
+            uint32_t targetId = this->graph.getEdgeTarget(e);
+            if (targetId == id || marks[targetId] == id || (this->symmetric && targetId < id))
+            {
+                continue;
+            }
+            marks[targetId] = id;
+            this->ends.push_back(id);
+            this->ends.push_back(targetId);
+            this->arcIds.push_back(e);
+            this->arcIds.push_back(NONE);
+        }
+    }
+    if (this->symmetric)
+    {
+        // Finds the arc toward the lower id of each edge, through the edges of the higher end
+        std::vector<uint32_t> edgeTo(nbViewVertices, NONE);
+        std::vector<std::vector<uint32_t>> edgesFrom(nbViewVertices);
+        for (uint32_t edge = 0; edge < this->ends.size() / 2; edge++)
+        {
+            edgesFrom[this->ends[2 * edge + 1]].push_back(edge);
+        }
+        for (uint32_t id = 0; id < nbViewVertices; id++)
+        {
+            for (uint32_t edge : edgesFrom[id])
+            {
+                edgeTo[this->ends[2 * edge]] = edge;
+            }
+            for (uint32_t e = this->graph.getFirstEdge(id); e < this->graph.getLastEdge(id); e++)
+            {
+                uint32_t targetId = this->graph.getEdgeTarget(e);
+                if (targetId < id && edgeTo[targetId] != NONE && this->arcIds[2 * edgeTo[targetId] + 1] == NONE)
+                {
+                    this->arcIds[2 * edgeTo[targetId] + 1] = e;
+                }
+            }
+            for (uint32_t edge : edgesFrom[id])
+            {
+                edgeTo[this->ends[2 * edge]] = NONE;
+            }
+        }
+        for (size_t i = 1; i < this->arcIds.size(); i += 2)
+        {
+            if (this->arcIds[i] == NONE)
+            {
+                this->arcIds[i] = this->arcIds[i - 1];
+            }
+        }
+    }
+    if (withAdditionalVertex)
+    {
+        for (uint32_t id = 0; id < nbViewVertices; id++)
+        {
+            this->ends.push_back(nbViewVertices);
+            this->ends.push_back(id);
+            this->arcIds.push_back(NONE);
+            this->arcIds.push_back(NONE);
+            if (!this->symmetric)
+            {
+                this->ends.push_back(id);
+                this->ends.push_back(nbViewVertices);
+                this->arcIds.push_back(NONE);
+                this->arcIds.push_back(NONE);
+            }
+        }
+    }
+
+    uint32_t nbEdges = this->ends.size() / 2;
+    uint32_t nbSlots = 2 * this->nbVertices;
+    this->states.assign(nbEdges, Undecided);
+    this->slotOffsets.assign(nbSlots + 1, 0);
+    for (uint32_t edge = 0; edge < nbEdges; edge++)
+    {
+        this->slotOffsets[this->getSlot(edge, 0) + 1]++;
+        this->slotOffsets[this->getSlot(edge, 1) + 1]++;
+    }
+    for (uint32_t slot = 0; slot < nbSlots; slot++)
+    {
+        this->slotOffsets[slot + 1] += this->slotOffsets[slot];
+    }
+    this->slotEdges.resize(2 * nbEdges);
+    std::vector<uint32_t> positions(this->slotOffsets.begin(), this->slotOffsets.end() - 1);
+    for (uint32_t edge = 0; edge < nbEdges; edge++)
+    {
+        this->slotEdges[positions[this->getSlot(edge, 0)]++] = edge;
+        this->slotEdges[positions[this->getSlot(edge, 1)]++] = edge;
+    }
+    this->nbFree.resize(nbSlots);
+    for (uint32_t slot = 0; slot < nbSlots; slot++)
+    {
+        this->nbFree[slot] = this->slotOffsets[slot + 1] - this->slotOffsets[slot];
+    }
+    this->nbRequired.assign(nbSlots, 0);
+    this->otherEnd.resize(this->nbVertices);
+    for (uint32_t vertex = 0; vertex < this->nbVertices; vertex++)
+    {
+        this->otherEnd[vertex] = vertex;
+    }
+    this->chainSize.assign(this->nbVertices, 1);
+    this->nbRequiredEdges = 0;
+    this->edgeLog.clear();
+    this->chainLog.clear();
+    this->toCheck.clear();
+}
+
+/// @brief Returns the slot of an end of an edge
+/// @param edge An edge
+/// @param end 0 for its first vertex, 1 for its second
+/// @returns The slot holding the edge at that end
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t HamiltonianSearch<W>::getSlot(uint32_t edge, uint32_t end) const
+{
+    return 2 * this->ends[2 * edge + end] + (this->symmetric ? 0 : end);
+}
+
+/// @brief Returns the other end of an edge
+/// @param edge An edge
+/// @param vertex One of its vertices
+/// @returns Its other vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t HamiltonianSearch<W>::getOtherEnd(uint32_t edge, uint32_t vertex) const
+{
+    return this->ends[2 * edge] ^ this->ends[2 * edge + 1] ^ vertex;
+}
+
+/// @brief Requires an undecided edge, joining the chains of its ends
+/// @param edge An undecided edge
+/// @returns Whether the edge could be required : false if one of its ends already has the required edges it needs (F4, F5),
+/// or if it closes a circuit missing some vertices (F6)
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+bool HamiltonianSearch<W>::require(uint32_t edge)
+{
+    uint32_t tailSlot = this->getSlot(edge, 0);
+    uint32_t headSlot = this->getSlot(edge, 1);
+    if (this->nbRequired[tailSlot] == this->needed || this->nbRequired[headSlot] == this->needed)
+    {
+        return false;
+    }
+    this->states[edge] = Required;
+    this->edgeLog.push_back(edge);
+    this->nbRequired[tailSlot]++;
+    this->nbRequired[headSlot]++;
+    this->nbRequiredEdges++;
+    this->toCheck.push_back(tailSlot);
+    this->toCheck.push_back(headSlot);
+
+    // The tail ends a chain and the head starts one, both being the vertex itself if it has no required edge yet
+    uint32_t chainStart = this->otherEnd[this->ends[2 * edge]];
+    uint32_t chainEnd = this->otherEnd[this->ends[2 * edge + 1]];
+    if (chainStart == this->ends[2 * edge + 1])
+    {
+        return this->chainSize[chainStart] == this->nbVertices;
+    }
+    uint32_t size = this->chainSize[chainStart] + this->chainSize[chainEnd];
+    this->chainLog.push_back({chainStart, this->otherEnd[chainStart], this->chainSize[chainStart]});
+    this->chainLog.push_back({chainEnd, this->otherEnd[chainEnd], this->chainSize[chainEnd]});
+    this->otherEnd[chainStart] = chainEnd;
+    this->otherEnd[chainEnd] = chainStart;
+    this->chainSize[chainStart] = size;
+    this->chainSize[chainEnd] = size;
+
+    // D3 : the edges from the end of the new chain back to its start would close a circuit too short
+    if (size < this->nbVertices)
+    {
+        uint32_t slot = 2 * chainEnd;
+        for (uint32_t i = this->slotOffsets[slot]; i < this->slotOffsets[slot + 1]; i++)
+        {
+            uint32_t closing = this->slotEdges[i];
+            if (this->states[closing] == Undecided && this->getOtherEnd(closing, chainEnd) == chainStart &&
+                (this->symmetric || this->ends[2 * closing] == chainEnd))
+            {
+                this->remove(closing);
+            }
+        }
+    }
+    return true;
+}
+
+/// @brief Deletes an undecided edge
+/// @param edge An undecided edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+void HamiltonianSearch<W>::remove(uint32_t edge)
+{
+    uint32_t tailSlot = this->getSlot(edge, 0);
+    uint32_t headSlot = this->getSlot(edge, 1);
+    this->states[edge] = Deleted;
+    this->edgeLog.push_back(edge);
+    this->nbFree[tailSlot]--;
+    this->nbFree[headSlot]--;
+    this->toCheck.push_back(tailSlot);
+    this->toCheck.push_back(headSlot);
+}
+
+/// @brief Applies the rules to the slots changed until none of them changes anything
+/// @returns Whether no failure rule applies
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+bool HamiltonianSearch<W>::propagate()
+{
+    while (!this->toCheck.empty())
+    {
+        uint32_t slot = this->toCheck.back();
+        this->toCheck.pop_back();
+        // F1, F2, F3 : too few edges left
+        if (this->nbFree[slot] < this->needed)
+        {
+            this->toCheck.clear();
+            return false;
+        }
+        if (this->nbFree[slot] == this->nbRequired[slot])
+        {
+            continue;
+        }
+        // R1, R2 : the edges left are all needed ; D1, D2 : the required edges are all there is room for
+        bool requiring = this->nbFree[slot] == this->needed;
+        if (!requiring && this->nbRequired[slot] < this->needed)
+        {
+            continue;
+        }
+        for (uint32_t i = this->slotOffsets[slot]; i < this->slotOffsets[slot + 1]; i++)
+        {
+            uint32_t edge = this->slotEdges[i];
+            if (this->states[edge] != Undecided)
+            {
+                continue;
+            }
+            if (!requiring)
+            {
+                this->remove(edge);
+            }
+            else if (!this->require(edge))
+            {
+                this->toCheck.clear();
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// @brief Undoes the changes logged after a point of the search
+/// @param edgeLogSize The length of the edge log to come back to
+/// @param chainLogSize The length of the chain log to come back to
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+void HamiltonianSearch<W>::undo(size_t edgeLogSize, size_t chainLogSize)
+{
+    while (this->chainLog.size() > chainLogSize)
+    {
+        const ChainChange &change = this->chainLog.back();
+        this->otherEnd[change.vertex] = change.otherEnd;
+        this->chainSize[change.vertex] = change.size;
+        this->chainLog.pop_back();
+    }
+    while (this->edgeLog.size() > edgeLogSize)
+    {
+        uint32_t edge = this->edgeLog.back();
+        uint32_t tailSlot = this->getSlot(edge, 0);
+        uint32_t headSlot = this->getSlot(edge, 1);
+        if (this->states[edge] == Required)
+        {
+            this->nbRequired[tailSlot]--;
+            this->nbRequired[headSlot]--;
+            this->nbRequiredEdges--;
+        }
+        else
+        {
+            this->nbFree[tailSlot]++;
+            this->nbFree[headSlot]++;
+        }
+        this->states[edge] = Undecided;
+        this->edgeLog.pop_back();
+    }
+}
+
+/// @brief Returns the edge to decide next
+/// @returns An undecided edge of the slot with the fewest undecided edges, leading to the vertex with the fewest edges left,
+/// NONE if every edge is decided
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The slots with a required edge come first : deciding their edges extends the chains, which the rules prune best.
+/// A path search decides the edges of the additional vertex before anything else, so that the ends of the path are chosen
+/// first, after which the other vertices are left with their own edges and the rules apply as they do to circuits.
+template <typename W>
+uint32_t HamiltonianSearch<W>::chooseEdge() const
+{
+    uint32_t bestSlot = NONE;
+    uint64_t bestScore = UINT64_MAX;
+    for (uint32_t slot = 0; slot < this->nbFree.size(); slot++)
+    {
+        uint32_t nbUndecided = this->nbFree[slot] - this->nbRequired[slot];
+        if (this->nbRequired[slot] == this->needed || nbUndecided == 0)
+        {
+            continue;
+        }
+        uint64_t score = uint64_t(slot / 2 != this->additionalVertex) << 33 | uint64_t(this->nbRequired[slot] == 0) << 32 | nbUndecided;
+        if (score < bestScore)
+        {
+            bestScore = score;
+            bestSlot = slot;
+        }
+    }
+    if (bestSlot == NONE)
+    {
+        return NONE;
+    }
+
+    uint32_t vertex = bestSlot / 2;
+    uint32_t bestEdge = NONE;
+    uint32_t bestNbFree = UINT32_MAX;
+    for (uint32_t i = this->slotOffsets[bestSlot]; i < this->slotOffsets[bestSlot + 1]; i++)
+    {
+        uint32_t edge = this->slotEdges[i];
+        if (this->states[edge] != Undecided)
+        {
+            continue;
+        }
+        uint32_t neighbour = this->getOtherEnd(edge, vertex);
+        uint32_t nbNeighbourFree = this->nbFree[2 * neighbour] + (this->symmetric ? 0 : this->nbFree[2 * neighbour + 1]);
+        if (nbNeighbourFree < bestNbFree)
+        {
+            bestNbFree = nbNeighbourFree;
+            bestEdge = edge;
+        }
+    }
+    return bestEdge;
+}
+
+/// @brief Follows the required edges once they form a hamiltonian circuit
+/// @param startingVertex The vertex the circuit starts from
+/// @returns The edges of the circuit in the order they are followed
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+std::vector<uint32_t> HamiltonianSearch<W>::followCircuit(uint32_t startingVertex) const
+{
+    std::vector<uint32_t> circuit;
+    circuit.reserve(this->nbVertices);
+    uint32_t vertex = startingVertex;
+    uint32_t previous = NONE;
+    do
+    {
+        uint32_t slot = 2 * vertex;
+        uint32_t next = NONE;
+        for (uint32_t i = this->slotOffsets[slot]; i < this->slotOffsets[slot + 1] && next == NONE; i++)
+        {
+            uint32_t edge = this->slotEdges[i];
+            if (this->states[edge] == Required && edge != previous && (this->symmetric || this->ends[2 * edge] == vertex))
+            {
+                next = edge;
+            }
+        }
+        circuit.push_back(next);
+        vertex = this->getOtherEnd(next, vertex);
+        previous = next;
+    } while (vertex != startingVertex);
+    return circuit;
+}
+
+/// @brief Runs a search
+/// @param circuit Whether the path must come back to its first vertex
+/// @param timeLimit The time after which the search gives up, zero for no limit
+/// @param cancelled A flag set from another thread to stop the search, nullptr if it cannot be cancelled
+/// @returns The outcome and the edge ids of the circuit or path
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+HamiltonianSearchResult HamiltonianSearch<W>::search(bool circuit, std::chrono::milliseconds timeLimit, const std::atomic<bool> *cancelled)
+{
+    HamiltonianSearchResult result;
+    uint32_t nbViewVertices = this->graph.getNbVertices();
+    if (nbViewVertices == 0)
+    {
+        return result;
+    }
+    if (nbViewVertices == 1)
+    {
+        for (uint32_t e = this->graph.getFirstEdge(0); e < this->graph.getLastEdge(0) && circuit; e++)
+        {
+            if (this->graph.getEdgeTarget(e) == 0)
+            {
+                result.edgeIds.push_back(e);
+                break;
+            }
+        }
+        result.status = circuit && result.edgeIds.empty() ? HamiltonianStatus::None : HamiltonianStatus::Found;
+        return result;
+    }
+
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeLimit;
+    this->build(!circuit);
+    for (uint32_t slot = 0; slot < this->nbFree.size(); slot++)
+    {
+        if (this->symmetric && slot % 2 == 1)
+        {
+            continue;
+        }
+        this->toCheck.push_back(slot);
+    }
+
+    std::vector<Decision> decisions;
+    uint32_t nbSteps = 0;
+    bool consistent = this->propagate();
+    while (true)
+    {
+        if (++nbSteps % CHECK_PERIOD == 0 &&
+            ((timeLimit != std::chrono::milliseconds::zero() && std::chrono::steady_clock::now() >= deadline) ||
+             (cancelled != nullptr && cancelled->load(std::memory_order_relaxed))))
+        {
+            result.status = HamiltonianStatus::Interrupted;
+            return result;
+        }
+
+        if (consistent)
+        {
+            if (this->nbRequiredEdges == this->nbVertices)
+            {
+                break;
+            }
+            uint32_t edge = this->chooseEdge();
+            if (edge != NONE)
+            {
+                decisions.push_back({edge, this->edgeLog.size(), this->chainLog.size(), false});
+                consistent = this->require(edge) && this->propagate();
+                continue;
+            }
+        }
+
+        // Backtracks to the last decision whose edge was required, and deletes it instead
+        while (!decisions.empty() && decisions.back().deleted)
+        {
+            decisions.pop_back();
+        }
+        if (decisions.empty())
+        {
+            return result;
+        }
+        Decision &decision = decisions.back();
+        this->undo(decision.edgeLogSize, decision.chainLogSize);
+        this->toCheck.clear();
+        decision.deleted = true;
+        this->remove(decision.edge);
+        consistent = this->propagate();
+    }
+
+    // The additional vertex of a path is left out, the path starting after it and ending before it
+    std::vector<uint32_t> edges = this->followCircuit(circuit ? 0 : nbViewVertices);
+    uint32_t vertex = circuit ? 0 : nbViewVertices;
+    result.status = HamiltonianStatus::Found;
+    result.edgeIds.reserve(edges.size());
+    for (uint32_t edge : edges)
+    {
+        bool forward = this->ends[2 * edge] == vertex;
+        uint32_t arcId = this->arcIds[2 * edge + (forward ? 0 : 1)];
+        if (arcId != NONE)
+        {
+            result.edgeIds.push_back(arcId);
+        }
+        vertex = this->getOtherEnd(edge, vertex);
+    }
+    return result;
+}
+
+#endif // HAMILTONIAN_SEARCH_H
@@ -0,0 +1,333 @@
+#ifndef HELD_KARP_H
+#define HELD_KARP_H
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include "csr_view.h"
+#include "thread_pool.h"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/// @brief Exact search for hamiltonian circuits and paths by dynamic programming over the subsets of vertices
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// For each subset of vertices, the engine computes the set of vertices at which a path starting from a fixed vertex
+/// and visiting exactly that subset can end (Held and Karp, 1962; Bellman, 1962) : a vertex ends such a path
+/// if it has an incoming edge from one of the ends of the subset without it. The ends are a bitset of a single word,
+/// so each subset costs one test per vertex it contains, and the whole search runs in O(2ⁿ·n) time and 2ⁿ⁻¹ words.
+/// A subset only depends on smaller ones, so the subsets of each size are split in chunks run by a thread pool.
+///
+/// A hamiltonian path is searched as a hamiltonian circuit through an additional vertex linked to all the others,
+/// which costs one more vertex. The time and memory double with each vertex : a circuit of MAX_VERTICES vertices
+/// uses 512 MiB and a few seconds, while 20 vertices take a few milliseconds.
+///
+/// The view is symmetric if it holds an arc in each direction for every edge, as the snapshot of an undirected graph does.
+/// Both arcs then stand for the same edge, so that a circuit must have at least 3 vertices.
+/// The engine refers to the view and the pool, which must outlive it, and can run any amount of searches.
+template <typename W = int> class HeldKarp
+{
+public:
+    HeldKarp(const CsrView<W> &graph, ThreadPool *pool = nullptr, bool symmetric = false);
+
+    std::vector<uint32_t> findCircuit() const;
+    std::vector<uint32_t> findPath() const;
+
+    /// @brief The largest amount of vertices of the circuits searched, a path having at most one vertex less
+    static constexpr uint32_t MAX_VERTICES = 28;
+    /// @brief The amount of vertices from which a search is worth the threads of a pool, smaller searches taking less than a millisecond
+    static constexpr uint32_t PARALLEL_VERTICES = 20;
+
+private:
+    /// @brief The subsets of a size are split in blocks sharing their highest bits, and enumerated within each block
+    static constexpr uint32_t BLOCK_BITS = 12;
+    /// @brief The amount of blocks per chunk of a parallel step
+    static constexpr size_t GRAIN_SIZE = 4;
+
+    static uint32_t lowestBit(uint32_t bits);
+    static uint32_t countBits(uint32_t bits);
+    std::vector<uint32_t> search(bool circuit) const;
+    uint32_t findEdge(uint32_t sourceId, uint32_t targetId) const;
+
+    /// @brief The searched view
+    const CsrView<W> &graph;
+    /// @brief The pool running the steps, nullptr to run them on the calling thread
+    ThreadPool *pool;
+    /// @brief Whether each edge is held by an arc in each direction
+    bool symmetric;
+};
+
+/// @brief Initializes the engine
+/// @param graph A CSR view, in memory or mapped
+/// @param pool The pool running the steps, nullptr to run them on the calling thread
+/// @param symmetric Whether the view holds an arc in each direction for every edge, both standing for the same edge
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+HeldKarp<W>::HeldKarp(const CsrView<W> &graph, ThreadPool *pool, bool symmetric)
+    : graph(graph), pool(pool), symmetric(symmetric)
+{
+}
+
+/// @brief Returns the index of the lowest bit set
+/// @param bits A non-zero word
+/// @returns The index of its lowest bit set
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t HeldKarp<W>::lowestBit(uint32_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(bits);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, bits);
+    return index;
+#else
+    uint32_t index = 0;
+    while (!(bits & 1))
+    {
+        bits >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/// @brief Returns the amount of bits set
+/// @param bits A word
+/// @returns The amount of bits set
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t HeldKarp<W>::countBits(uint32_t bits)
+{
+    bits = bits - ((bits >> 1) & 0x55555555);
+    bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+    return (((bits + (bits >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+}
+
+/// @brief Returns a hamiltonian circuit, which goes through every vertex once and comes back to the first one
+/// @returns The edge ids of the circuit in the order they are followed from the vertex 0,
+/// empty if there is none or if the view has more than MAX_VERTICES vertices
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The circuit of a single vertex is one of its loops.
+template <typename W>
+std::vector<uint32_t> HeldKarp<W>::findCircuit() const
+{
+    return this->search(true);
+}
+
+/// @brief Returns a hamiltonian path, which goes through every vertex once
+/// @returns The edge ids of the path in the order they are followed,
+/// empty if there is none, if the view has a single vertex or more than MAX_VERTICES - 1 vertices
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+std::vector<uint32_t> HeldKarp<W>::findPath() const
+{
+    return this->search(false);
+}
+
+/// @brief Returns the id of an edge between two vertices
+/// @param sourceId The id of the source vertex
+/// @param targetId The id of the target vertex
+/// @returns The id of the first edge from the source to the target, CsrView::NO_VERTEX if there is none
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+uint32_t HeldKarp<W>::findEdge(uint32_t sourceId, uint32_t targetId) const
+{
+    for (uint32_t e = this->graph.getFirstEdge(sourceId); e < this->graph.getLastEdge(sourceId); e++)
+    {
+        if (this->graph.getEdgeTarget(e) == targetId)
+        {
+            return e;
+        }
+    }
+    return CsrView<W>::NO_VERTEX;
+}
+
+/// @brief Runs the dynamic programming and follows the ends back from the full subset
+/// @param circuit Whether the path must come back to its first vertex
+/// @returns The edge ids of the circuit or path, empty if there is none
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// A circuit starts from the vertex 0 and a path from an additional vertex, linked both ways to every vertex.
+/// The subsets are made of the other vertices, the vertex `id` being the bit `id - 1` for circuits and `id` for paths.
+template <typename W>
+std::vector<uint32_t> HeldKarp<W>::search(bool circuit) const
+{
+    uint32_t nbVertices = this->graph.getNbVertices();
+    std::vector<uint32_t> edgeIds;
+    if (nbVertices == 0 || (circuit ? nbVertices > MAX_VERTICES : nbVertices > MAX_VERTICES - 1 || nbVertices < 2))
+    {
+        return edgeIds;
+    }
+    if (circuit && nbVertices == 1)
+    {
+        uint32_t loop = this->findEdge(0, 0);
+        if (loop != CsrView<W>::NO_VERTEX)
+        {
+            edgeIds.push_back(loop);
+        }
+        return edgeIds;
+    }
+    if (circuit && this->symmetric && nbVertices == 2)
+    {
+        return edgeIds;
+    }
+
+    // Bitsets of the vertices linked from the start, linked to the start, and linked to each vertex
+    uint32_t first = circuit ? 1 : 0;
+    uint32_t nbBits = nbVertices - first;
+    uint32_t full = nbBits == 32 ? UINT32_MAX : (1u << nbBits) - 1;
+    uint32_t fromStart = circuit ? 0 : full;
+    uint32_t toStart = circuit ? 0 : full;
+    std::vector<uint32_t> predecessors(nbBits, 0);
+    for (uint32_t id = 0; id < nbVertices; id++)
+    {
+        for (uint32_t e = this->graph.getFirstEdge(id); e < this->graph.getLastEdge(id); e++)
+        {
+            uint32_t targetId = this->graph.getEdgeTarget(e);
+            if (targetId == id)
+            {
+                continue;
+            }
+            if (id < first)
+            {
+                fromStart |= 1u << (targetId - first);
+            }
+            else if (targetId < first)
+            {
+                toStart |= 1u << (id - first);
+            }
+            else
+            {
+                predecessors[targetId - first] |= 1u << (id - first);
+            }
+        }
+    }
+    // Every vertex of a circuit has a predecessor and a successor, which rules out most graphs without building the subsets
+    if (circuit)
+    {
+        if (fromStart == 0 || toStart == 0)
+        {
+            return edgeIds;
+        }
+        std::vector<bool> hasSuccessor(nbBits, false);
+        for (uint32_t bit = 0; bit < nbBits; bit++)
+        {
+            for (uint32_t rest = predecessors[bit]; rest != 0; rest &= rest - 1)
+            {
+                hasSuccessor[lowestBit(rest)] = true;
+            }
+        }
+        for (uint32_t bit = 0; bit < nbBits; bit++)
+        {
+            bool hasPredecessor = predecessors[bit] != 0 || (fromStart >> bit & 1);
+            if (!hasPredecessor || !(hasSuccessor[bit] || (toStart >> bit & 1)))
+            {
+                return edgeIds;
+            }
+        }
+    }
+
+    // ends[subset] holds the vertices at which a path from the start visiting exactly the subset can end
+    std::vector<uint32_t> ends(size_t(1) << nbBits, 0);
+    for (uint32_t bit = 0; bit < nbBits; bit++)
+    {
+        ends[size_t(1) << bit] = fromStart & (1u << bit);
+    }
+    auto computeEnds = [&](uint32_t subset)
+    {
+        uint32_t subsetEnds = 0;
+        for (uint32_t rest = subset; rest != 0; rest &= rest - 1)
+        {
+            uint32_t bit = lowestBit(rest);
+            if (ends[subset ^ (1u << bit)] & predecessors[bit])
+            {
+                subsetEnds |= 1u << bit;
+            }
+        }
+        ends[subset] = subsetEnds;
+    };
+
+    ThreadPool sequential(1);
+    ThreadPool &pool = this->pool != nullptr ? *this->pool : sequential;
+    uint32_t blockBits = std::min(nbBits, BLOCK_BITS);
+    uint32_t blockEnd = 1u << blockBits;
+    size_t nbBlocks = size_t(1) << (nbBits - blockBits);
+    for (uint32_t size = 2; size <= nbBits; size++)
+    {
+        pool.parallelFor(0, nbBlocks, GRAIN_SIZE, [&](size_t begin, size_t end, unsigned)
+                         {
+            for (size_t block = begin; block < end; block++)
+            {
+                uint32_t high = uint32_t(block) << blockBits;
+                uint32_t highSize = countBits(high);
+                if (highSize > size || size - highSize > blockBits)
+                {
+                    continue;
+                }
+                if (highSize == size)
+                {
+                    computeEnds(high);
+                    continue;
+                }
+                // Enumerates the low parts of size - highSize bits by increasing value (Gosper's hack)
+                for (uint32_t low = (1u << (size - highSize)) - 1; low < blockEnd;)
+                {
+                    computeEnds(high | low);
+                    uint32_t lowest = low & (0u - low);
+                    uint32_t ripple = low + lowest;
+                    low = (((ripple ^ low) >> 2) / lowest) | ripple;
+                }
+            } });
+    }
+
+    // Follows the ends back from the full subset, the last vertex being linked to the start for a circuit
+    uint32_t candidates = ends[full] & toStart;
+    if (candidates == 0)
+    {
+        return edgeIds;
+    }
+    std::vector<uint32_t> ids;
+    ids.reserve(nbVertices + 1);
+    if (circuit)
+    {
+        ids.push_back(0);
+    }
+    uint32_t subset = full;
+    uint32_t bit = lowestBit(candidates);
+    while (true)
+    {
+        ids.push_back(bit + first);
+        subset ^= 1u << bit;
+        if (subset == 0)
+        {
+            break;
+        }
+        bit = lowestBit(ends[subset] & predecessors[bit]);
+    }
+    if (circuit)
+    {
+        ids.push_back(0);
+    }
+    // The vertices were collected from the end of the walk
+    std::reverse(ids.begin(), ids.end());
+
+    edgeIds.reserve(ids.size() - 1);
+    for (size_t i = 0; i + 1 < ids.size(); i++)
+    {
+        edgeIds.push_back(this->findEdge(ids[i], ids[i + 1]));
+    }
+    return edgeIds;
+}
+
+#endif // HELD_KARP_H
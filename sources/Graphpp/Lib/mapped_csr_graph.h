@@ -0,0 +1,366 @@
+#ifndef MAPPED_CSR_GRAPH_H
+#define MAPPED_CSR_GRAPH_H
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "csr_view.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// @brief Read-only compressed-sparse-row (CSR) graph stored in a file and memory-mapped, for graphs larger than the memory
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The file is mapped read-only and never read as a whole : the operating system pages the arrays in
+/// as the traversals of CsrView touch them, and may evict them again under memory pressure.
+/// A file is written from any CSR view, typically the snapshot returned by Graph::freeze(), with save().
+///
+/// The file is made of a header, the offsets and the targets arrays, then the weights array aligned on the weight type.
+/// All the values are stored in the byte order of the machine that wrote the file.
+/// open() checks the header, the size of the file and the offsets, but not the targets, which would page in the whole file.
+template <typename W = int> class MappedCsrGraph : public CsrView<W>
+{
+public:
+    /// @brief The type used to pass and compute weights, int for unweighted graphs whose weights are all 1
+    typedef typename WeightTraits<W>::type Weight;
+
+    MappedCsrGraph();
+    MappedCsrGraph(const MappedCsrGraph &other) = delete;
+    MappedCsrGraph(MappedCsrGraph &&other) noexcept;
+    ~MappedCsrGraph();
+    MappedCsrGraph &operator=(const MappedCsrGraph &other) = delete;
+    MappedCsrGraph &operator=(MappedCsrGraph &&other) noexcept;
+
+    static bool save(const std::string &path, const CsrView<W> &graph);
+    bool open(const std::string &path);
+    void close();
+    bool isOpen() const;
+
+private:
+    /// @brief The header at the start of a file
+    struct Header
+    {
+        /// @brief Identifies the format, FILE_MAGIC
+        uint32_t magic;
+        /// @brief The version of the format, FILE_VERSION
+        uint32_t version;
+        /// @brief The size of a weight in bytes, 0 for unweighted graphs
+        uint32_t weightSize;
+        /// @brief The amount of vertices
+        uint32_t nbVertices;
+        /// @brief The amount of arcs
+        uint32_t nbArcs;
+        /// @brief Unused, keeps the arrays 8-byte aligned
+        uint32_t reserved;
+    };
+
+    /// @brief Identifies a Graph++ CSR file, "GCSR" in little-endian order
+    static constexpr uint32_t FILE_MAGIC = 0x52534347;
+    /// @brief The version of the format written by save()
+    static constexpr uint32_t FILE_VERSION = 1;
+    /// @brief The offsets of an empty graph, used while no file is mapped
+    static constexpr uint32_t EMPTY_OFFSETS[1] = {0};
+
+    static size_t getWeightsPosition(uint32_t nbVertices, uint32_t nbArcs);
+    static size_t getFileSize(uint32_t nbVertices, uint32_t nbArcs);
+    bool bind();
+
+    /// @brief The first byte of the mapping, nullptr when no file is open
+    const char *data = nullptr;
+    /// @brief The size of the mapping in bytes
+    size_t size = 0;
+#ifdef _WIN32
+    /// @brief The file mapping object backing the view
+    HANDLE mapping = nullptr;
+#endif
+};
+
+/// @brief Initializes an empty graph, with no file mapped
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+MappedCsrGraph<W>::MappedCsrGraph()
+{
+    this->setArrays(0, 0, EMPTY_OFFSETS, nullptr, nullptr);
+}
+
+/// @brief Takes the mapping of another graph, which is left closed
+/// @param other Another graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+MappedCsrGraph<W>::MappedCsrGraph(MappedCsrGraph &&other) noexcept
+{
+    *this = std::move(other);
+}
+
+/// @brief Unmaps the file
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+MappedCsrGraph<W>::~MappedCsrGraph()
+{
+    this->close();
+}
+
+/// @brief Closes the mapped file and takes the mapping of another graph, which is left closed
+/// @param other Another graph
+/// @returns This graph
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+MappedCsrGraph<W> &MappedCsrGraph<W>::operator=(MappedCsrGraph &&other) noexcept
+{
+    if (this != &other)
+    {
+        this->close();
+        std::swap(this->data, other.data);
+        std::swap(this->size, other.size);
+#ifdef _WIN32
+        std::swap(this->mapping, other.mapping);
+#endif
+        this->bind();
+        other.bind();
+    }
+    return *this;
+}
+
+/// @brief Returns the position of the weights array in a file
+/// @param nbVertices The amount of vertices
+/// @param nbArcs The amount of arcs
+/// @returns The position in bytes, aligned on the weight type
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+size_t MappedCsrGraph<W>::getWeightsPosition(uint32_t nbVertices, uint32_t nbArcs)
+{
+    size_t position = sizeof(Header) + (size_t(nbVertices) + 1 + nbArcs) * sizeof(uint32_t);
+    return (position + alignof(Weight) - 1) / alignof(Weight) * alignof(Weight);
+}
+
+/// @brief Returns the size of a file
+/// @param nbVertices The amount of vertices
+/// @param nbArcs The amount of arcs
+/// @returns The size in bytes
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+size_t MappedCsrGraph<W>::getFileSize(uint32_t nbVertices, uint32_t nbArcs)
+{
+    if constexpr (WeightTraits<W>::weighted)
+    {
+        return getWeightsPosition(nbVertices, nbArcs) + size_t(nbArcs) * sizeof(Weight);
+    }
+    else
+    {
+        return sizeof(Header) + (size_t(nbVertices) + 1 + nbArcs) * sizeof(uint32_t);
+    }
+}
+
+/// @brief Writes a graph to a file that can be mapped with open()
+/// @param path The path of the file, replaced if it exists
+/// @param graph A CSR view, typically a snapshot returned by Graph::freeze()
+/// @returns Whether the file was written
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+bool MappedCsrGraph<W>::save(const std::string &path, const CsrView<W> &graph)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    Header header = {FILE_MAGIC, FILE_VERSION, WeightTraits<W>::weighted ? uint32_t(sizeof(Weight)) : 0,
+                     graph.getNbVertices(), graph.getNbArcs(), 0};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+
+    // the targets and weights are written one by one, so that a mapped graph can be saved without loading its edges in memory
+    std::vector<uint32_t> offsets;
+    offsets.reserve(header.nbVertices + 1);
+    for (uint32_t id = 0; id < header.nbVertices; id++)
+    {
+        offsets.push_back(graph.getFirstEdge(id));
+    }
+    offsets.push_back(header.nbArcs);
+    file.write(reinterpret_cast<const char *>(offsets.data()), offsets.size() * sizeof(uint32_t));
+
+    for (uint32_t edgeId = 0; edgeId < header.nbArcs; edgeId++)
+    {
+        uint32_t target = graph.getEdgeTarget(edgeId);
+        file.write(reinterpret_cast<const char *>(&target), sizeof(uint32_t));
+    }
+
+    if constexpr (WeightTraits<W>::weighted)
+    {
+        size_t padding = getWeightsPosition(header.nbVertices, header.nbArcs) - sizeof(Header) -
+                         (size_t(header.nbVertices) + 1 + header.nbArcs) * sizeof(uint32_t);
+        const char zeros[alignof(Weight)] = {};
+        file.write(zeros, padding);
+        for (uint32_t edgeId = 0; edgeId < header.nbArcs; edgeId++)
+        {
+            Weight weight = graph.getEdgeWeight(edgeId);
+            file.write(reinterpret_cast<const char *>(&weight), sizeof(Weight));
+        }
+    }
+
+    file.close();
+    return !file.fail();
+}
+
+/// @brief Maps a file written by save(), closing the file mapped before
+/// @param path The path of the file
+/// @returns Whether the file was mapped, false if it cannot be opened or is not a valid graph of this weight type
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+bool MappedCsrGraph<W>::open(const std::string &path)
+{
+    this->close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < LONGLONG(sizeof(Header)))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    this->mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (this->mapping == nullptr)
+    {
+        return false;
+    }
+    this->data = static_cast<const char *>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+    if (this->data == nullptr)
+    {
+        CloseHandle(this->mapping);
+        this->mapping = nullptr;
+        return false;
+    }
+    this->size = size_t(fileSize.QuadPart);
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+    struct stat status;
+    if (fstat(file, &status) != 0 || status.st_size < off_t(sizeof(Header)))
+    {
+        ::close(file);
+        return false;
+    }
+    // the mapping keeps its own reference to the file, which can be closed right away
+    void *address = mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+    this->data = static_cast<const char *>(address);
+    this->size = size_t(status.st_size);
+#endif
+
+    if (!this->bind())
+    {
+        this->close();
+        return false;
+    }
+    return true;
+}
+
+/// @brief Checks the mapped file and points the view to its arrays
+/// @returns Whether the mapped file is a valid graph of this weight type, the view being left empty otherwise
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+bool MappedCsrGraph<W>::bind()
+{
+    this->setArrays(0, 0, EMPTY_OFFSETS, nullptr, nullptr);
+    if (this->data == nullptr)
+    {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, this->data, sizeof(Header));
+    uint32_t weightSize = WeightTraits<W>::weighted ? uint32_t(sizeof(Weight)) : 0;
+    if (header.magic != FILE_MAGIC || header.version != FILE_VERSION || header.weightSize != weightSize ||
+        header.nbVertices == UINT32_MAX || this->size != getFileSize(header.nbVertices, header.nbArcs))
+    {
+        return false;
+    }
+
+    const uint32_t *offsets = reinterpret_cast<const uint32_t *>(this->data + sizeof(Header));
+    const uint32_t *targets = offsets + header.nbVertices + 1;
+    if (offsets[0] != 0 || offsets[header.nbVertices] != header.nbArcs)
+    {
+        return false;
+    }
+    for (uint32_t id = 0; id < header.nbVertices; id++)
+    {
+        if (offsets[id] > offsets[id + 1])
+        {
+            return false;
+        }
+    }
+
+    const Weight *weights = nullptr;
+    if constexpr (WeightTraits<W>::weighted)
+    {
+        weights = reinterpret_cast<const Weight *>(this->data + getWeightsPosition(header.nbVertices, header.nbArcs));
+    }
+    this->setArrays(header.nbVertices, header.nbArcs, offsets, targets, weights);
+    return true;
+}
+
+/// @brief Unmaps the file, leaving the graph empty
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+void MappedCsrGraph<W>::close()
+{
+    if (this->data != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(this->data);
+        CloseHandle(this->mapping);
+        this->mapping = nullptr;
+#else
+        munmap(const_cast<char *>(this->data), this->size);
+#endif
+        this->data = nullptr;
+        this->size = 0;
+    }
+    this->setArrays(0, 0, EMPTY_OFFSETS, nullptr, nullptr);
+}
+
+/// @brief Returns whether a file is mapped
+/// @returns Whether a file is mapped
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename W>
+bool MappedCsrGraph<W>::isOpen() const
+{
+    return this->data != nullptr;
+}
+
+#endif // MAPPED_CSR_GRAPH_H
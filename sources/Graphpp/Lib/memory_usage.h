@@ -0,0 +1,54 @@
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+#include <cstddef>
+
+/// @brief Memory footprint of a graph in bytes, broken down by category, see Graph::memoryUsage()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The sizes count the heap storage of the containers from their capacities, so they include the reserved but unused space.
+/// Hash containers are estimated from their bucket and element counts, the exact node layout depending on the standard library.
+/// The overhead of the heap allocator itself and the vertices, which are owned by the graph but of any type T, are not counted.
+struct MemoryUsage
+{
+    /// @brief The vertex ids, the tables indexed by them and the free ids
+    size_t vertexTable = 0;
+    /// @brief The adjacency map and the storage of the adjacency lists
+    size_t adjacency = 0;
+    /// @brief The edges created by the graph, including the free slots of their allocator
+    size_t edges = 0;
+    /// @brief The incoming edge index
+    size_t incomingIndex = 0;
+    /// @brief The edge index, by end vertices
+    size_t edgeIndex = 0;
+    /// @brief The cached structural properties
+    size_t cache = 0;
+
+    /// @brief Returns the sum of all the categories
+    /// @returns The total amount of bytes
+    size_t getTotal() const
+    {
+        return this->vertexTable + this->adjacency + this->edges + this->incomingIndex + this->edgeIndex + this->cache;
+    }
+};
+
+/// @brief Returns the heap storage of a vector
+/// @param vector A std::vector
+/// @returns Its capacity in bytes
+template <typename Vector> size_t vectorMemoryUsage(const Vector &vector)
+{
+    return vector.capacity() * sizeof(typename Vector::value_type);
+}
+
+/// @brief Returns an estimate of the heap storage of an unordered map or set
+/// @param container A std::unordered_map or std::unordered_set
+/// @returns Its bucket array and one node per element, made of a pointer to the next node and the element, in bytes
+///
+/// An empty container has a single bucket, stored in the container itself, which is not counted.
+template <typename HashContainer> size_t hashMemoryUsage(const HashContainer &container)
+{
+    size_t buckets = container.bucket_count() > 1 ? container.bucket_count() * sizeof(void *) : 0;
+    return buckets + container.size() * (sizeof(void *) + sizeof(typename HashContainer::value_type));
+}
+
+#endif // MEMORY_USAGE_H
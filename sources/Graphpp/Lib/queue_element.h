@@ -1,5 +1,8 @@
 #ifndef QUEUE_ELEMENT_H
 #define QUEUE_ELEMENT_H
+#include <queue>
+#include <type_traits>
+#include <vector>
 #include "edge.h"
 
 /**
@@ -7,35 +10,101 @@
  *
  * This structure is used for different graph search algorithms where vertices
  * and the way (source and egde) through which they were discovered must be saved in a priority queue.
+ * The vertices are held by their ids in the searched graph, so that popping an element needs no lookup.
  */
-template <typename T>
+template <typename T, typename W = int>
 struct queue_element{
     /**
      * @brief Builds a new queue element.
      * @param The priority of this element in the queue.
-     * @param The vertex from which the element was discovered.
+     * @param The id of the vertex from which the element was discovered.
      * @param The edge connecting the source and the element.
+     * @param The id of the element, i.e. of the vertex reached through the edge.
      */
-    queue_element(int priority, T*source, Edge<T>* edge){
+    queue_element(typename WeightTraits<W>::type priority, uint32_t sourceId, Edge<T, W>* edge, uint32_t targetId){
         this->priority = priority;
-        this->source = source;
+        this->sourceId = sourceId;
         this->edge = edge;
+        this->targetId = targetId;
     }
-    ~queue_element<T>(){}
+    ~queue_element(){}
 
     /**
      * @brief The priority of this element in the queue.
      */
-    int priority;
+    typename WeightTraits<W>::type priority;
     /**
-     * @brief The vertex from which the element was discovered
+     * @brief The id of the vertex from which the element was discovered
      */
-    T* source;
+    uint32_t sourceId;
 
     /**
      * @brief The edge connecting the source and the element.
      */
-    Edge<T>* edge;
+    Edge<T, W>* edge;
+
+    /**
+     * @brief The id of the element in the searched graph.
+     *
+     * In an undirected graph, the edge can be followed backwards, so the element is not always its target.
+     */
+    uint32_t targetId;
+};
+
+/**
+ * @brief The queue of the graph search algorithms, which pops the element of lowest priority first.
+ *
+ * For weighted edges, it is a binary heap. For unweighted edges, every edge adds 1 to the priority,
+ * so the elements are pushed in nondecreasing order of priority : a FIFO queue is enough,
+ * and the search algorithms become breadth-first searches.
+ */
+template <typename T, typename W = int>
+class search_queue{
+public:
+    /**
+     * @brief Adds an element to the queue.
+     * @param The element.
+     */
+    void push(const queue_element<T, W>& element){
+        this->elements.push(element);
+    }
+
+    /**
+     * @brief Removes the element of lowest priority from the queue.
+     * @return The element.
+     */
+    queue_element<T, W> pop(){
+        if constexpr (WeightTraits<W>::weighted){
+            queue_element<T, W> top = this->elements.top();
+            this->elements.pop();
+            return top;
+        } else {
+            queue_element<T, W> front = this->elements.front();
+            this->elements.pop();
+            return front;
+        }
+    }
+
+    /**
+     * @brief Returns whether the queue is empty.
+     */
+    bool empty() const{
+        return this->elements.empty();
+    }
+
+private:
+    struct compare{
+        bool operator()(const queue_element<T, W>& left, const queue_element<T, W>& right) const{
+            return left.priority > right.priority;
+        }
+    };
+
+    /**
+     * @brief The elements, in a binary heap or in a FIFO queue.
+     */
+    typename std::conditional<WeightTraits<W>::weighted,
+                              std::priority_queue<queue_element<T, W>, std::vector<queue_element<T, W>>, compare>,
+                              std::queue<queue_element<T, W>>>::type elements;
 };
 
 #endif // QUEUE_ELEMENT_H
@@ -0,0 +1,104 @@
+#ifndef SHORTEST_PATHS_H
+#define SHORTEST_PATHS_H
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "edge.h"
+
+/// @brief Shortest paths from a starting vertex to every vertex of a graph, see Graph::getShortestPaths()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The result is a plain value indexed by the vertex ids of the graph it was computed on : for every vertex,
+/// its distance from the starting vertex and the edge through which its shortest path reaches it.
+/// It does not own anything : the edges must not be used once they are removed from the graph.
+template <typename T, typename W = int> struct ShortestPaths
+{
+    /// @brief The type used to pass and compute weights, int for unweighted graphs whose weights are all 1
+    typedef typename WeightTraits<W>::type Weight;
+
+    /// @brief Value used for an absent vertex id
+    static constexpr uint32_t NO_VERTEX = UINT32_MAX;
+    /// @brief Distance of the vertices that cannot be reached
+    static constexpr Weight UNREACHABLE = std::numeric_limits<Weight>::max();
+
+    /// @brief The id of the starting vertex, NO_VERTEX if it is not in the graph
+    uint32_t startingVertexId = NO_VERTEX;
+    /// @brief Maps a vertex id to its distance from the starting vertex, UNREACHABLE if it cannot be reached
+    std::vector<Weight> distances;
+    /// @brief Maps a vertex id to the id of the vertex before it on its shortest path,
+    /// NO_VERTEX for the starting vertex and the vertices that cannot be reached
+    std::vector<uint32_t> predecessors;
+    /// @brief Maps a vertex id to the edge followed from its predecessor, nullptr when it has no predecessor
+    std::vector<Edge<T, W> *> predecessorEdges;
+
+    bool isReachable(uint32_t id) const;
+    Weight getDistance(uint32_t id) const;
+    std::vector<Edge<T, W> *> getPath(uint32_t id) const;
+    std::vector<Edge<T, W> *> getTreeEdges() const;
+};
+
+/// @brief Returns whether a vertex can be reached from the starting vertex
+/// @param id The id of the vertex
+/// @returns Whether the vertex can be reached
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+bool ShortestPaths<T, W>::isReachable(uint32_t id) const
+{
+    return id < this->distances.size() && this->distances[id] != UNREACHABLE;
+}
+
+/// @brief Returns the distance of a vertex from the starting vertex
+/// @param id The id of the vertex
+/// @returns The distance, UNREACHABLE if the vertex cannot be reached
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+typename ShortestPaths<T, W>::Weight ShortestPaths<T, W>::getDistance(uint32_t id) const
+{
+    return id < this->distances.size() ? this->distances[id] : UNREACHABLE;
+}
+
+/// @brief Returns the shortest path from the starting vertex to a vertex
+/// @param id The id of the vertex
+/// @returns The edges of the path, from the starting vertex on, empty if the vertex cannot be reached or is the starting vertex
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+std::vector<Edge<T, W> *> ShortestPaths<T, W>::getPath(uint32_t id) const
+{
+    std::vector<Edge<T, W> *> path;
+    if (!this->isReachable(id))
+    {
+        return path;
+    }
+    for (uint32_t current = id; this->predecessors[current] != NO_VERTEX; current = this->predecessors[current])
+    {
+        path.push_back(this->predecessorEdges[current]);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+/// @brief Returns the edges of the shortest paths tree
+/// @returns The edge followed to reach each vertex but the starting one, by increasing vertex id
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+template <typename T, typename W>
+std::vector<Edge<T, W> *> ShortestPaths<T, W>::getTreeEdges() const
+{
+    std::vector<Edge<T, W> *> edges;
+    for (Edge<T, W> *edge : this->predecessorEdges)
+    {
+        if (edge != nullptr)
+        {
+            edges.push_back(edge);
+        }
+    }
+    return edges;
+}
+
+#endif // SHORTEST_PATHS_H
@@ -0,0 +1,49 @@
+#ifndef SNAPSHOT_EPOCH_H
+#define SNAPSHOT_EPOCH_H
+#include <memory>
+#include <vector>
+
+/// @brief Defers the deletion of the vertices removed from a graph while snapshots may still refer to them
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// Taking a snapshot of a graph (see Graph::snapshot()) ends the current epoch : the snapshot keeps it alive,
+/// and the graph goes on with a new epoch, which the ended one keeps alive in turn.
+/// A vertex removed from the graph is retired into the current epoch instead of being deleted
+/// whenever an older epoch, and so an older snapshot, is still alive. It is deleted with the epoch,
+/// once every snapshot taken before its removal has been destroyed, whichever thread destroys it.
+template <typename T> struct SnapshotEpoch
+{
+    SnapshotEpoch() = default;
+    SnapshotEpoch(const SnapshotEpoch &) = delete;
+    SnapshotEpoch &operator=(const SnapshotEpoch &) = delete;
+    ~SnapshotEpoch();
+
+    /// @brief The vertices removed from the graph during this epoch, deleted with it
+    std::vector<T *> retired;
+    /// @brief The epoch that followed this one, kept alive by it
+    std::shared_ptr<SnapshotEpoch> next;
+};
+
+/// @brief Deletes the retired vertices and releases the following epochs
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The chain of following epochs only referenced by this one is released iteratively,
+/// so a long chain cannot overflow the stack.
+template <typename T>
+SnapshotEpoch<T>::~SnapshotEpoch()
+{
+    for (T *vertex : this->retired)
+    {
+        delete vertex;
+    }
+    std::shared_ptr<SnapshotEpoch> following = std::move(this->next);
+    while (following != nullptr && following.use_count() == 1)
+    {
+        std::shared_ptr<SnapshotEpoch> after = std::move(following->next);
+        following = std::move(after);
+    }
+}
+
+#endif // SNAPSHOT_EPOCH_H
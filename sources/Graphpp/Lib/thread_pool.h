@@ -0,0 +1,196 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief Fixed set of worker threads running the chunks of parallel loops, see parallelFor()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+///
+/// The workers are started once and wait between loops, so that algorithms made of many short parallel steps,
+/// such as the levels of a breadth-first search, do not pay for starting threads at each step.
+/// The thread calling parallelFor() runs chunks as well, and a pool of a single thread runs everything on it.
+///
+/// A pool runs one loop at a time : parallelFor() must not be called concurrently, nor from inside a loop.
+class ThreadPool
+{
+public:
+    explicit ThreadPool(unsigned nbThreads = std::thread::hardware_concurrency());
+    ThreadPool(const ThreadPool &other) = delete;
+    ThreadPool &operator=(const ThreadPool &other) = delete;
+    ~ThreadPool();
+
+    unsigned getNbThreads() const;
+    template <typename Function>
+    void parallelFor(size_t begin, size_t end, size_t grainSize, Function function);
+
+private:
+    void work(unsigned threadIndex);
+    void runChunks(unsigned threadIndex);
+
+    /// @brief The worker threads, the calling thread being the thread 0
+    std::vector<std::thread> workers;
+    /// @brief Guards the loop being run and the counters below
+    std::mutex mutex;
+    /// @brief Wakes the workers up when a loop starts or the pool stops
+    std::condition_variable loopStarted;
+    /// @brief Wakes the calling thread up when the last worker is done with the loop
+    std::condition_variable loopDone;
+    /// @brief Incremented at each loop, so that the workers know they have a new one to run
+    uint64_t generation = 0;
+    /// @brief The amount of workers still running the current loop
+    unsigned nbBusyWorkers = 0;
+    /// @brief Whether the workers must exit
+    bool stopping = false;
+
+    /// @brief The body of the current loop, called with a chunk [begin, end) and the index of the thread
+    std::function<void(size_t, size_t, unsigned)> body;
+    /// @brief The beginning of the next chunk to run
+    std::atomic<size_t> nextChunk{0};
+    /// @brief The end of the current loop
+    size_t loopEnd = 0;
+    /// @brief The size of the chunks of the current loop
+    size_t chunkSize = 1;
+};
+
+/// @brief Starts the worker threads
+/// @param nbThreads The amount of threads running the loops, including the calling thread, at least 1
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline ThreadPool::ThreadPool(unsigned nbThreads)
+{
+    nbThreads = std::max(nbThreads, 1u);
+    this->workers.reserve(nbThreads - 1);
+    for (unsigned threadIndex = 1; threadIndex < nbThreads; threadIndex++)
+    {
+        this->workers.emplace_back(&ThreadPool::work, this, threadIndex);
+    }
+}
+
+/// @brief Stops and joins the worker threads
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->loopStarted.notify_all();
+    for (std::thread &worker : this->workers)
+    {
+        worker.join();
+    }
+}
+
+/// @brief Returns the amount of threads running the loops
+/// @returns The amount of threads, including the calling thread
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline unsigned ThreadPool::getNbThreads() const
+{
+    return this->workers.size() + 1;
+}
+
+/// @brief Runs a loop in parallel, split in chunks handed out to the threads as they become free
+/// @param begin The first index of the loop
+/// @param end The index following the last index of the loop
+/// @param grainSize The amount of indices per chunk, at least 1
+/// @param function Called with the range [chunkBegin, chunkEnd) of each chunk and the index of the thread running it,
+/// ranging from 0 to getNbThreads() - 1, so that the threads can accumulate their results separately
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+///
+/// The chunks start at begin + k * grainSize. The call returns once every chunk has been run.
+template <typename Function>
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grainSize, Function function)
+{
+    grainSize = std::max<size_t>(grainSize, 1);
+    if (begin >= end)
+    {
+        return;
+    }
+    if (this->workers.empty() || end - begin <= grainSize)
+    {
+        for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize)
+        {
+            function(chunkBegin, std::min(end, chunkBegin + grainSize), 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->body = [&function](size_t chunkBegin, size_t chunkEnd, unsigned threadIndex)
+        { function(chunkBegin, chunkEnd, threadIndex); };
+        this->nextChunk.store(begin);
+        this->loopEnd = end;
+        this->chunkSize = grainSize;
+        this->nbBusyWorkers = this->workers.size();
+        this->generation++;
+    }
+    this->loopStarted.notify_all();
+
+    this->runChunks(0);
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->loopDone.wait(lock, [this]
+                        { return this->nbBusyWorkers == 0; });
+    this->body = nullptr;
+}
+
+/// @brief Runs the chunks of the loops until the pool stops
+/// @param threadIndex The index of the worker
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline void ThreadPool::work(unsigned threadIndex)
+{
+    uint64_t seenGeneration = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->loopStarted.wait(lock, [this, seenGeneration]
+                                   { return this->stopping || this->generation != seenGeneration; });
+            if (this->stopping)
+            {
+                return;
+            }
+            seenGeneration = this->generation;
+        }
+
+        this->runChunks(threadIndex);
+
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (--this->nbBusyWorkers == 0)
+        {
+            this->loopDone.notify_one();
+        }
+    }
+}
+
+/// @brief Runs chunks of the current loop until there is none left
+/// @param threadIndex The index of the running thread
+/// @author The Graph++ Development Team
+/// @date 17.10.2026
+inline void ThreadPool::runChunks(unsigned threadIndex)
+{
+    while (true)
+    {
+        size_t chunkBegin = this->nextChunk.fetch_add(this->chunkSize);
+        if (chunkBegin >= this->loopEnd)
+        {
+            return;
+        }
+        this->body(chunkBegin, std::min(this->loopEnd, chunkBegin + this->chunkSize), threadIndex);
+    }
+}
+
+#endif // THREAD_POOL_H
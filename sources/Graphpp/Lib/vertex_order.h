@@ -0,0 +1,19 @@
+#ifndef VERTEX_ORDER_H
+#define VERTEX_ORDER_H
+
+/// @brief Order in which the vertices of a CSR graph are relabelled to improve the locality of its traversals,
+/// see CsrView::getVertexOrdering() and CompactGraph::reorder()
+/// @author The Graph++ Development Team
+/// @date autumn 2026
+enum class VertexOrder
+{
+    /// @brief By descending outdegree, so that the most visited vertices share the first cache lines
+    Degree,
+    /// @brief In breadth-first order from the first vertex of each connected part, so that neighbours get close ids
+    BreadthFirst,
+    /// @brief Reverse Cuthill-McKee : breadth-first from a vertex of minimum degree, visiting neighbours by increasing degree,
+    /// then reversed, which keeps the ids of the ends of each edge close to each other (low bandwidth)
+    ReverseCuthillMcKee
+};
+
+#endif // VERTEX_ORDER_H
@@ -14,19 +14,26 @@ public:
 
 private:
     Graph<int>* graph;
-    int* vertices;
+    std::vector<int*> vertices;
     int nbVertices = 10;
 
 private slots:
     void test_vertices();
     void test_edges();
+    void test_findEdge();
+    void test_twins();
     void test_weight();
+    void test_cachedProperties();
     void test_indegrees();
     void test_outdegrees();
     void test_connectivity();
     void test_strongConnectivity();
+    void test_stronglyConnectedComponents();
+    void test_weakConnectivity();
     void test_orientation();
+    void test_undirected();
     void test_eulerian();
+    void test_eulerianPath();
     void test_hamiltonian();
     void test_chromaticNumber();
 
@@ -35,22 +42,20 @@ private slots:
 BasicGraphTest::BasicGraphTest()
 {
     graph = new Graph<int>();
-    vertices = new int[nbVertices];
     for(int i = 0; i < nbVertices; i++){
-        vertices[i] = i;
+        vertices.push_back(new int(i));
     }
 }
 
 BasicGraphTest::~BasicGraphTest()
 {
-    delete vertices;
     delete graph;
 }
 void BasicGraphTest::test_vertices()
 {
     QCOMPARE(graph->getNbVertices(), 0);
     for(int i = 0; i < nbVertices; i++){
-        graph->addVertex(&vertices[i]);
+        graph->addVertex(vertices[i]);
         QCOMPARE(graph->getNbVertices(), i+1);
     }
 }
@@ -63,26 +68,86 @@ void BasicGraphTest::test_edges()
         if(nextIndex >= nbVertices){
             nextIndex = 0;
         }
-        graph->addDoubleEdge(&vertices[i], &vertices[nextIndex]);
+        graph->addDoubleEdge(vertices[i], vertices[nextIndex]);
     }
     QCOMPARE(graph->getNbEdges(), nbVertices);
 }
 
+void BasicGraphTest::test_findEdge()
+{
+    // Lookups and duplicate checks must give the same results with and without the edge index
+    for(bool indexed : {false, true}){
+        graph->setEdgeIndex(indexed);
+        for(int i = 0; i < nbVertices; i++){
+            int nextIndex = (i + 1) % nbVertices;
+            Edge<int>* edge = graph->findEdge(vertices[i], vertices[nextIndex]);
+            QVERIFY(edge != nullptr);
+            QCOMPARE(edge->getTarget(), vertices[nextIndex]);
+            QVERIFY(graph->findEdge(vertices[nextIndex], vertices[i]) != nullptr);
+            QVERIFY(graph->findEdge(vertices[i], vertices[(i + 2) % nbVertices]) == nullptr);
+            graph->addEdge(vertices[i], vertices[nextIndex]);
+        }
+        QCOMPARE(graph->getNbEdges(), nbVertices);
+    }
+}
+
+void BasicGraphTest::test_twins()
+{
+    // Each edge knows its source and is linked to the edge in the opposite direction
+    for(int i = 0; i < nbVertices; i++){
+        int nextIndex = (i + 1) % nbVertices;
+        Edge<int>* edge = graph->findEdge(vertices[i], vertices[nextIndex]);
+        QCOMPARE(edge->getSource(), vertices[i]);
+        QCOMPARE(edge->getTwin(), graph->findEdge(vertices[nextIndex], vertices[i]));
+        QCOMPARE(edge->getTwin()->getTwin(), edge);
+    }
+
+    // Popping an edge unlinks its twin, restoring the adjacency list links them again
+    Graph<int>::AdjacencyMap saved = graph->adjacencyList;
+    Edge<int>* edge = graph->findEdge(vertices[0], vertices[1]);
+    Edge<int>* twin = edge->getTwin();
+    graph->popEdge(edge);
+    QVERIFY(graph->findEdge(vertices[0], vertices[1]) == nullptr);
+    QVERIFY(twin->getTwin() == nullptr);
+    graph->adjacencyList = saved;
+    graph->rebuildIndexes();
+    QCOMPARE(twin->getTwin(), edge);
+    QCOMPARE(graph->getNbEdges(), nbVertices);
+}
+
 void BasicGraphTest::test_weight()
 {
     QVERIFY(!graph->isWeighted());
 }
 
+void BasicGraphTest::test_cachedProperties()
+{
+    // Reweighting an edge through the graph must invalidate the cached weightedness
+    Edge<int>* edge = graph->findEdge(vertices[0], vertices[1]);
+    uint64_t version = graph->getVersion();
+    graph->setEdgeWeight(edge, 3);
+    QVERIFY(graph->getVersion() > version);
+    QVERIFY(graph->isWeighted());
+    graph->setEdgeWeight(edge, 1);
+    QVERIFY(!graph->isWeighted());
+
+    DegreeStatistics statistics = graph->getDegreeStatistics();
+    QCOMPARE(statistics.minIndegree, 2);
+    QCOMPARE(statistics.maxIndegree, 2);
+    QCOMPARE(statistics.minOutdegree, 2);
+    QCOMPARE(statistics.maxOutdegree, 2);
+    QCOMPARE(statistics.nbUnbalancedVertices, 0);
+}
 
 void BasicGraphTest::test_indegrees()
 {
     for(int i = 0; i < nbVertices; i++){
-        QCOMPARE(graph->getVertexIndegree(&vertices[i]), 2);
+        QCOMPARE(graph->getVertexIndegree(vertices[i]), 2);
     }
 }
 void BasicGraphTest::test_outdegrees(){
     for(int i = 0; i < nbVertices; i++){
-        QCOMPARE(graph->getVertexOutdegree(&vertices[i]), 2);
+        QCOMPARE(graph->getVertexOutdegree(vertices[i]), 2);
     }
 }
 
@@ -93,7 +158,88 @@ void BasicGraphTest::test_connectivity()
 
 void BasicGraphTest::test_strongConnectivity()
 {
-    QVERIFY(!graph->isStronglyConnected());
+    // Every edge of the cycle goes both ways
+    QVERIFY(graph->isStronglyConnected());
+}
+
+void BasicGraphTest::test_stronglyConnectedComponents()
+{
+    // Two cycles 0 -> 1 -> 2 -> 0 and 3 -> 4 -> 3, linked by 2 -> 3, and the vertex 5 reached from 4
+    Graph<int> directed;
+    std::vector<int*> chain;
+    for(int i = 0; i < 6; i++){
+        chain.push_back(new int(i));
+    }
+    directed.addVertices(chain);
+    directed.addEdge(chain[0], chain[1]);
+    directed.addEdge(chain[1], chain[2]);
+    directed.addEdge(chain[2], chain[0]);
+    directed.addEdge(chain[2], chain[3]);
+    directed.addEdge(chain[3], chain[4]);
+    directed.addEdge(chain[4], chain[3]);
+    directed.addEdge(chain[4], chain[5]);
+    QVERIFY(directed.isConnected());
+    QVERIFY(!directed.isStronglyConnected());
+
+    StronglyConnectedComponents components = directed.getStronglyConnectedComponents();
+    QCOMPARE(components.getNbComponents(), 3u);
+    uint32_t first = components.getComponent(directed.getVertexId(chain[0]));
+    uint32_t second = components.getComponent(directed.getVertexId(chain[3]));
+    uint32_t last = components.getComponent(directed.getVertexId(chain[5]));
+    QVERIFY(components.areConnected(directed.getVertexId(chain[0]), directed.getVertexId(chain[2])));
+    QVERIFY(!components.areConnected(directed.getVertexId(chain[2]), directed.getVertexId(chain[3])));
+    QCOMPARE(components.sizes[first], 3u);
+    QCOMPARE(components.sizes[second], 2u);
+    QCOMPARE(components.sizes[last], 1u);
+
+    // The condensation is the path first -> second -> last, in topological order
+    QVERIFY(first < second && second < last);
+    QVERIFY(components.getSuccessors(first) == std::vector<uint32_t>({second}));
+    QVERIFY(components.getSuccessors(second) == std::vector<uint32_t>({last}));
+    QVERIFY(components.getSuccessors(last).empty());
+
+    // A cycle long enough to overflow the call stack of a recursive search
+    Graph<int> longCycle;
+    std::vector<int*> cycle;
+    int cycleLength = 200000;
+    for(int i = 0; i < cycleLength; i++){
+        cycle.push_back(new int(i));
+    }
+    longCycle.addVertices(cycle);
+    for(int i = 0; i < cycleLength; i++){
+        longCycle.addEdge(cycle[i], cycle[(i + 1) % cycleLength]);
+    }
+    QVERIFY(longCycle.isStronglyConnected());
+    longCycle.removeEdge(longCycle.findEdge(cycle[cycleLength - 1], cycle[0]));
+    QCOMPARE(longCycle.getStronglyConnectedComponents().getNbComponents(), (uint32_t)cycleLength);
+}
+
+void BasicGraphTest::test_weakConnectivity()
+{
+    // 0 -> 1 <- 2 : the vertex 2 cannot be reached from the vertex 0, but the graph is weakly connected
+    for(bool incomingIndex : {false, true}){
+        Graph<int> directed;
+        directed.setIncomingEdgeIndex(incomingIndex);
+        std::vector<int*> chain = {new int(0), new int(1), new int(2), new int(3)};
+        directed.addVertices(chain);
+        directed.addEdge(chain[0], chain[1]);
+        directed.addEdge(chain[2], chain[1]);
+
+        ConnectedComponents components = directed.getConnectedComponents();
+        QCOMPARE(components.getNbComponents(), 2u);
+        QVERIFY(components.areConnected(directed.getVertexId(chain[0]), directed.getVertexId(chain[2])));
+        QVERIFY(!components.areConnected(directed.getVertexId(chain[0]), directed.getVertexId(chain[3])));
+        QVERIFY(!directed.isConnected());
+
+        // Once the isolated vertex is removed, its id belongs to no component
+        uint32_t removedId = directed.getVertexId(chain[3]);
+        directed.removeVertex(chain[3]);
+        components = directed.getConnectedComponents();
+        QCOMPARE(components.getNbComponents(), 1u);
+        QCOMPARE(components.sizes[0], 3u);
+        QCOMPARE(components.getComponent(removedId), ConnectedComponents::NO_COMPONENT);
+        QVERIFY(directed.isConnected());
+    }
 }
 
 void BasicGraphTest::test_orientation()
@@ -101,19 +247,171 @@ void BasicGraphTest::test_orientation()
     QVERIFY(!graph->isOriented());
 }
 
+void BasicGraphTest::test_undirected()
+{
+    // The same circular graph, each edge being stored once and followed both ways
+    Graph<int, int, Undirected> undirected;
+    std::vector<int*> cycle;
+    for(int i = 0; i < nbVertices; i++){
+        cycle.push_back(new int(i));
+        undirected.addVertex(cycle[i]);
+    }
+    for(int i = 0; i < nbVertices; i++){
+        undirected.addDoubleEdge(cycle[i], cycle[(i + 1) % nbVertices]);
+    }
+    QCOMPARE(undirected.getNbEdges(), nbVertices);
+    QVERIFY(!undirected.isOriented());
+    for(int i = 0; i < nbVertices; i++){
+        int nextIndex = (i + 1) % nbVertices;
+        QCOMPARE(undirected.getVertexIndegree(cycle[i]), 2);
+        QCOMPARE(undirected.getVertexOutdegree(cycle[i]), 2);
+        QVERIFY(undirected.findEdge(cycle[i], cycle[nextIndex]) != nullptr);
+        QCOMPARE(undirected.findEdge(cycle[nextIndex], cycle[i]), undirected.findEdge(cycle[i], cycle[nextIndex]));
+    }
+    QVERIFY(undirected.isConnected());
+    QVERIFY(undirected.isEulerian());
+    QCOMPARE(undirected.getChromaticNumber(), 2);
+
+    Graph<int, int, Undirected>* tree = undirected.getMinimumSpanningTree();
+    QCOMPARE(tree->getNbVertices(), nbVertices);
+    QCOMPARE(tree->getNbEdges(), nbVertices - 1);
+    QVERIFY(tree->isConnected());
+    delete tree;
+}
+
 void BasicGraphTest::test_eulerian()
 {
     QVERIFY(graph->isEulerian());
+
+    // Each pair of opposite edges is walked through once, in one direction
+    std::vector<Edge<int>*> circuit = graph->getEulerianPath();
+    QCOMPARE((int)circuit.size(), graph->getNbEdges());
+    for(size_t i = 0; i < circuit.size(); i++){
+        QCOMPARE(circuit[(i + 1) % circuit.size()]->getSource(), circuit[i]->getTarget());
+    }
+}
+
+void BasicGraphTest::test_eulerianPath()
+{
+    // 0 -> 1 -> 2 -> 0 -> 3 : the walk must start from 0 and end at 3, the isolated vertex 4 being ignored
+    Graph<int> directed;
+    std::vector<int*> path;
+    for(int i = 0; i < 5; i++){
+        path.push_back(new int(i));
+    }
+    directed.addVertices(path);
+    directed.addEdge(path[0], path[1]);
+    directed.addEdge(path[1], path[2]);
+    directed.addEdge(path[2], path[0]);
+    directed.addEdge(path[0], path[3]);
+    QVERIFY(directed.getEulerianKind() == EulerianKind::Path);
+    QVERIFY(!directed.isEulerian());
+    std::vector<Edge<int>*> walk = directed.getEulerianPath();
+    QCOMPARE((int)walk.size(), 4);
+    QCOMPARE(walk.front()->getSource(), path[0]);
+    QCOMPARE(walk.back()->getTarget(), path[3]);
+    for(size_t i = 0; i + 1 < walk.size(); i++){
+        QCOMPARE(walk[i + 1]->getSource(), walk[i]->getTarget());
+    }
+
+    // Two vertices with an extra outgoing edge
+    directed.addEdge(path[1], path[3]);
+    QVERIFY(directed.getEulerianKind() == EulerianKind::None);
+    QVERIFY(directed.getEulerianPath().empty());
+
+    // An undirected triangle with a loop and a pendant edge : 3 - 0 - 1 - 2 - 0, the loop on 1 counting twice
+    Graph<int, int, Undirected> undirected;
+    std::vector<int*> triangle;
+    for(int i = 0; i < 4; i++){
+        triangle.push_back(new int(i));
+    }
+    undirected.addVertices(triangle);
+    undirected.addEdge(triangle[0], triangle[1]);
+    undirected.addEdge(triangle[2], triangle[1]);
+    undirected.addEdge(triangle[0], triangle[2]);
+    undirected.addEdge(triangle[1], triangle[1]);
+    undirected.addEdge(triangle[3], triangle[0]);
+    QVERIFY(undirected.getEulerianKind() == EulerianKind::Path);
+    walk = undirected.getEulerianPath();
+    QCOMPARE((int)walk.size(), 5);
+    std::unordered_set<Edge<int>*> walked(walk.begin(), walk.end());
+    QCOMPARE((int)walked.size(), 5);
+    // Each edge shares an end with the next one
+    for(size_t i = 0; i + 1 < walk.size(); i++){
+        int* ends[] = {walk[i]->getSource(), walk[i]->getTarget()};
+        QVERIFY(ends[0] == walk[i + 1]->getSource() || ends[0] == walk[i + 1]->getTarget() ||
+                ends[1] == walk[i + 1]->getSource() || ends[1] == walk[i + 1]->getTarget());
+    }
+
+    // A triangle of prebuilt edges in both directions, which are not linked as twins :
+    // the edges walked backwards are replaced by the edge in the opposite direction
+    std::vector<Edge<int>> prebuiltEdges;
+    std::vector<int*> cycle;
+    for(int i = 0; i < 3; i++){
+        cycle.push_back(new int(i));
+    }
+    for(int i = 0; i < 3; i++){
+        prebuiltEdges.push_back(Edge<int>(cycle[(i + 1) % 3]));
+        prebuiltEdges.push_back(Edge<int>(cycle[i]));
+    }
+    Graph<int> prebuilt;
+    prebuilt.addVertices(cycle);
+    for(int i = 0; i < 3; i++){
+        prebuilt.addPrebuiltEdge(cycle[i], &prebuiltEdges[2 * i]);
+        prebuilt.addPrebuiltEdge(cycle[(i + 1) % 3], &prebuiltEdges[2 * i + 1]);
+    }
+    QVERIFY(!prebuilt.isOriented());
+    QVERIFY(prebuilt.getEulerianKind() == EulerianKind::Circuit);
+    walk = prebuilt.getEulerianPath();
+    QCOMPARE((int)walk.size(), 3);
+    for(size_t i = 0; i < walk.size(); i++){
+        QVERIFY(walk[i]->getTwin() == nullptr);
+        QCOMPARE(walk[(i + 1) % walk.size()]->getSource(), walk[i]->getTarget());
+    }
 }
 
 void BasicGraphTest::test_chromaticNumber()
 {
     QCOMPARE(graph->getChromaticNumber(), 2);
+
+    // A prebuilt edge leading out of the graph does not count
+    int outside = -1;
+    Edge<int> leaving(&outside);
+    Graph<int> partial;
+    partial.addVertex(new int(0));
+    partial.addPrebuiltEdge(partial.adjacencyList.begin()->first, &leaving);
+    QCOMPARE(partial.getChromaticNumber(), 1);
+
+    // Nor is it followed by the spanning tree and the shortest paths
+    int* inside = partial.adjacencyList.begin()->first;
+    QVERIFY(partial.getMinimumSpanningTreeEdges().empty());
+    ShortestPaths<int> paths = partial.getShortestPaths(inside);
+    QVERIFY(paths.getTreeEdges().empty());
+    QCOMPARE(paths.getDistance(partial.getVertexId(inside)), 0);
 }
 
 void BasicGraphTest::test_hamiltonian()
 {
     QVERIFY(graph->isHamiltonian());
+    // The circuit goes around C10, the path stops before coming back
+    std::vector<Edge<int>*> circuit = graph->getHamiltonianPathEdges();
+    QCOMPARE((int)circuit.size(), nbVertices);
+    for(int i = 0; i < nbVertices; i++){
+        QCOMPARE(circuit[i]->getTarget(), circuit[(i + 1) % nbVertices]->getSource());
+    }
+    QCOMPARE((int)graph->getHamiltonianPathEdges(false).size(), nbVertices - 1);
+
+    // Without an edge, C10 becomes a path
+    Edge<int>* edge = graph->findEdge(vertices[3], vertices[4]);
+    Edge<int>* twin = edge->getTwin();
+    graph->removeEdge(edge);
+    graph->removeEdge(twin);
+    QVERIFY(!graph->isHamiltonian());
+    QVERIFY(graph->getHamiltonianStatus(std::chrono::milliseconds(1)) == HamiltonianStatus::None);
+    std::vector<Edge<int>*> path = graph->getHamiltonianPathEdges(false);
+    QCOMPARE((int)path.size(), nbVertices - 1);
+    graph->addDoubleEdge(vertices[3], vertices[4]);
+    QVERIFY(graph->isHamiltonian());
 }
 
 QTEST_APPLESS_MAIN(BasicGraphTest)
@@ -0,0 +1,631 @@
+#include <QTest>
+#include <QTemporaryDir>
+
+// add necessary includes here
+#include <breadth_first_search.h>
+#include <compressed_adjacency.h>
+#include <graph.h>
+#include <hamiltonian_search.h>
+#include <held_karp.h>
+#include <mapped_csr_graph.h>
+
+/// @brief This class tests the compressed-sparse-row snapshot of a graph.
+///
+/// The tested graph is the complete graph K10, where each edge's weight is equal to the
+/// index of the source vertex multiplied by the index of the target vertex (indices range from 1 to 10).
+/// The results computed on the snapshot are compared to the ones computed on the graph.
+class CompactGraphTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    CompactGraphTest();
+    ~CompactGraphTest();
+
+private:
+    Graph<int>* graph;
+    CompactGraph<int> snapshot;
+    std::vector<int*> vertices;
+    int nbVertices = 10;
+
+private slots:
+    void test_vertices();
+    void test_edges();
+    void test_connectivity();
+    void test_chromaticNumber();
+    void test_minimumSpanningTree();
+    void test_minimumDistanceTree();
+    void test_disconnected();
+    void test_unweighted();
+    void test_memoryUsage();
+    void test_mappedFile();
+    void test_compressedAdjacency();
+    void test_reorder();
+    void test_breadthFirstSearch();
+    void test_heldKarp();
+    void test_hamiltonianSearch();
+
+};
+
+CompactGraphTest::CompactGraphTest()
+{
+    graph = new Graph<int>();
+    for(int i = 0; i < nbVertices; i++){
+        vertices.push_back(new int(i+1));
+        graph->addVertex(vertices[i]);
+    }
+    for(int i = 0; i < nbVertices;i++){
+        for(int j = 0; j < nbVertices; j++){
+            if(i != j){
+                graph->addEdge(vertices[i], vertices[j], *vertices[i] * *vertices[j]);
+            }
+        }
+    }
+    snapshot = graph->freeze();
+}
+
+CompactGraphTest::~CompactGraphTest()
+{
+    delete graph;
+}
+
+void CompactGraphTest::test_vertices()
+{
+    QCOMPARE((int)snapshot.getNbVertices(), graph->getNbVertices());
+    for(int i = 0; i < nbVertices; i++){
+        uint32_t id = snapshot.getVertexId(vertices[i]);
+        QVERIFY(id != CompactGraph<int>::NO_VERTEX);
+        QCOMPARE(snapshot.getVertex(id), vertices[i]);
+        QCOMPARE((int)snapshot.getVertexOutdegree(id), graph->getVertexOutdegree(vertices[i]));
+    }
+}
+
+void CompactGraphTest::test_edges()
+{
+    QCOMPARE((int)snapshot.getNbArcs(), 2 * graph->getNbEdges());
+    for(uint32_t id = 0; id < snapshot.getNbVertices(); id++){
+        for(uint32_t e = snapshot.getFirstEdge(id); e < snapshot.getLastEdge(id); e++){
+            Edge<int>* edge = snapshot.getEdge(e);
+            QCOMPARE(snapshot.getEdgeSource(e), id);
+            QCOMPARE(snapshot.getVertex(snapshot.getEdgeTarget(e)), edge->getTarget());
+            QCOMPARE(snapshot.getEdgeWeight(e), edge->getWeight());
+        }
+    }
+}
+
+void CompactGraphTest::test_connectivity()
+{
+    QCOMPARE(snapshot.isConnected(), graph->isConnected());
+}
+
+void CompactGraphTest::test_chromaticNumber()
+{
+    QCOMPARE(snapshot.getChromaticNumber(), nbVertices);
+}
+
+void CompactGraphTest::test_minimumSpanningTree()
+{
+    // The tree is the star centered on the '1' vertex
+    std::vector<uint32_t> tree = snapshot.getMinimumSpanningTree();
+    QCOMPARE((int)tree.size(), nbVertices - 1);
+    int weight = 0;
+    for(uint32_t e : tree){
+        weight += snapshot.getEdgeWeight(e);
+    }
+    QCOMPARE(weight, (nbVertices * (nbVertices + 1)) / 2 - 1);
+}
+
+void CompactGraphTest::test_minimumDistanceTree()
+{
+    // From any vertex k, the shortest path to j is either the direct edge or the path through the '1' vertex
+    for(int k = 0; k < nbVertices; k++){
+        std::vector<int> distances;
+        std::vector<uint32_t> predecessors = snapshot.getMinimumDistanceTree(snapshot.getVertexId(vertices[k]), &distances);
+        for(int j = 0; j < nbVertices; j++){
+            uint32_t id = snapshot.getVertexId(vertices[j]);
+            int expected = j == k ? 0 : std::min(*vertices[k] * *vertices[j], *vertices[k] + *vertices[j]);
+            QCOMPARE(distances[id], expected);
+            QCOMPARE(predecessors[id] == CompactGraph<int>::NO_EDGE, j == k);
+        }
+    }
+}
+
+void CompactGraphTest::test_disconnected()
+{
+    int outside = 0;
+    Edge<int> leaving(&outside, 3);
+    Graph<int> other;
+    other.addVertex(new int(1));
+    other.addVertex(new int(2));
+    CompactGraph<int> otherSnapshot = other.freeze();
+    QVERIFY(!otherSnapshot.isConnected());
+    std::vector<int> distances;
+    otherSnapshot.getMinimumDistanceTree(0, &distances);
+    QCOMPARE(distances[1], CompactGraph<int>::UNREACHABLE);
+    QCOMPARE((int)otherSnapshot.getMinimumSpanningTree().size(), 0);
+
+    // A prebuilt edge leading out of the graph has no arc, rather than one towards the vertex 0
+    int* first = other.adjacencyList.begin()->first;
+    other.addPrebuiltEdge(first, &leaving);
+    other.addEdge(first, std::next(other.adjacencyList.begin())->first, 5);
+    otherSnapshot = other.freeze();
+    QCOMPARE(otherSnapshot.getNbArcs(), 1u);
+    QCOMPARE(otherSnapshot.getEdgeTarget(0), 1u);
+    QCOMPARE(otherSnapshot.getEdgeWeight(0), 5);
+    QVERIFY(otherSnapshot.getEdge(0) != &leaving);
+}
+
+void CompactGraphTest::test_unweighted()
+{
+    // An unweighted K10 stores no weights, and its distance tree is the star around the starting vertex
+    Graph<int, void> unweighted;
+    std::vector<int*> unweightedVertices;
+    for(int i = 0; i < nbVertices; i++){
+        unweightedVertices.push_back(new int(i+1));
+    }
+    unweighted.addVertices(unweightedVertices);
+    for(int i = 0; i < nbVertices; i++){
+        for(int j = 0; j < nbVertices; j++){
+            if(i != j){
+                unweighted.addEdge(unweightedVertices[i], unweightedVertices[j]);
+            }
+        }
+    }
+    QVERIFY(!unweighted.isWeighted());
+
+    CompactGraph<int, void> unweightedSnapshot = unweighted.freeze();
+    QVERIFY(unweightedSnapshot.getWeights().empty());
+    QCOMPARE((int)unweightedSnapshot.getMinimumSpanningTree().size(), nbVertices - 1);
+    std::vector<int> distances;
+    unweightedSnapshot.getMinimumDistanceTree(0, &distances);
+    for(uint32_t id = 1; id < unweightedSnapshot.getNbVertices(); id++){
+        QCOMPARE(distances[id], 1);
+    }
+}
+
+void CompactGraphTest::test_memoryUsage()
+{
+    MemoryUsage usage = graph->memoryUsage();
+    QVERIFY(usage.vertexTable >= nbVertices * sizeof(int*));
+    QVERIFY(usage.adjacency > 0);
+    QVERIFY(usage.edges >= graph->getNbEdges() * 2 * sizeof(Edge<int>));
+    QCOMPARE(usage.edgeIndex, size_t(0));
+    QCOMPARE(usage.getTotal(), usage.vertexTable + usage.adjacency + usage.edges + usage.incomingIndex + usage.edgeIndex + usage.cache);
+
+    // The edge index is accounted for as soon as it is enabled
+    graph->setEdgeIndex(true);
+    QVERIFY(graph->memoryUsage().edgeIndex > 0);
+    graph->setEdgeIndex(false);
+
+    // The snapshot stores the same arcs in flat arrays
+    MemoryUsage compactUsage = snapshot.memoryUsage();
+    QVERIFY(compactUsage.edges >= snapshot.getNbArcs() * (sizeof(uint32_t) + sizeof(int)));
+    QVERIFY(compactUsage.getTotal() < usage.getTotal());
+}
+
+void CompactGraphTest::test_mappedFile()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    std::string path = directory.filePath("k10.csr").toStdString();
+    QVERIFY(MappedCsrGraph<int>::save(path, snapshot));
+
+    // The mapped file runs the same traversals as the snapshot it was written from
+    MappedCsrGraph<int> mapped;
+    QVERIFY(mapped.open(path));
+    QCOMPARE(mapped.getNbVertices(), snapshot.getNbVertices());
+    QCOMPARE(mapped.getNbArcs(), snapshot.getNbArcs());
+    for(uint32_t e = 0; e < snapshot.getNbArcs(); e++){
+        QCOMPARE(mapped.getEdgeTarget(e), snapshot.getEdgeTarget(e));
+        QCOMPARE(mapped.getEdgeWeight(e), snapshot.getEdgeWeight(e));
+    }
+    QCOMPARE(mapped.isConnected(), snapshot.isConnected());
+    QCOMPARE(mapped.getChromaticNumber(), snapshot.getChromaticNumber());
+    int mappedWeight = 0;
+    for(uint32_t e : mapped.getMinimumSpanningTree()){
+        mappedWeight += mapped.getEdgeWeight(e);
+    }
+    int snapshotWeight = 0;
+    for(uint32_t e : snapshot.getMinimumSpanningTree()){
+        snapshotWeight += snapshot.getEdgeWeight(e);
+    }
+    QCOMPARE(mappedWeight, snapshotWeight);
+    std::vector<int> mappedDistances, snapshotDistances;
+    mapped.getMinimumDistanceTree(0, &mappedDistances);
+    snapshot.getMinimumDistanceTree(0, &snapshotDistances);
+    QVERIFY(mappedDistances == snapshotDistances);
+
+    // A file of another weight type is refused, and a moved graph keeps the mapping
+    MappedCsrGraph<void> unweighted;
+    QVERIFY(!unweighted.open(path));
+    QVERIFY(!unweighted.isOpen());
+    MappedCsrGraph<int> moved = std::move(mapped);
+    QVERIFY(moved.isOpen());
+    QVERIFY(!mapped.isOpen());
+    QCOMPARE(mapped.getNbVertices(), uint32_t(0));
+    QCOMPARE(moved.getNbArcs(), snapshot.getNbArcs());
+    moved.close();
+    QVERIFY(!moved.open(directory.filePath("missing.csr").toStdString()));
+}
+
+void CompactGraphTest::test_compressedAdjacency()
+{
+    CompressedAdjacency compressed(snapshot);
+    QCOMPARE(compressed.getNbVertices(), snapshot.getNbVertices());
+    QCOMPARE(compressed.getNbArcs(), snapshot.getNbArcs());
+    for(uint32_t id = 0; id < snapshot.getNbVertices(); id++){
+        std::vector<uint32_t> targets(snapshot.getTargets().begin() + snapshot.getFirstEdge(id),
+                                      snapshot.getTargets().begin() + snapshot.getLastEdge(id));
+        std::sort(targets.begin(), targets.end());
+        QVERIFY(compressed.getNeighbours(id) == targets);
+        QCOMPARE(compressed.getVertexOutdegree(id), snapshot.getVertexOutdegree(id));
+    }
+    QVERIFY(compressed.isConnected());
+    std::vector<uint32_t> distances = compressed.getBreadthFirstDistances(3);
+    for(uint32_t id = 0; id < compressed.getNbVertices(); id++){
+        QCOMPARE(distances[id], id == 3 ? 0u : 1u);
+    }
+
+    // Gaps of K10 take a byte each instead of the 4 bytes of a target
+    QVERIFY(compressed.memoryUsage().edges * 3 <= snapshot.getNbArcs() * sizeof(uint32_t));
+
+    // A sparse path with distant ids, so that the first neighbours lie before the vertices and gaps take several bytes
+    Graph<int> path;
+    std::vector<int*> pathVertices;
+    for(int i = 0; i < 300; i++){
+        pathVertices.push_back(new int(i));
+    }
+    path.addVertices(pathVertices);
+    for(int i = 0; i + 1 < 150; i++){
+        path.addEdge(pathVertices[i], pathVertices[i + 1], 1);
+        path.addEdge(pathVertices[i], pathVertices[299 - i], 1);
+    }
+    CompactGraph<int> pathSnapshot = path.freeze();
+    CompressedAdjacency pathCompressed(pathSnapshot);
+    std::vector<int> expectedDistances;
+    pathSnapshot.getMinimumDistanceTree(0, &expectedDistances);
+    std::vector<uint32_t> pathDistances = pathCompressed.getBreadthFirstDistances(0);
+    for(uint32_t id = 0; id < pathCompressed.getNbVertices(); id++){
+        QCOMPARE(pathDistances[id] == CompressedAdjacency::UNREACHABLE, expectedDistances[id] == CompactGraph<int>::UNREACHABLE);
+        if(pathDistances[id] != CompressedAdjacency::UNREACHABLE){
+            QCOMPARE((int)pathDistances[id], expectedDistances[id]);
+        }
+    }
+    QVERIFY(!pathCompressed.isConnected());
+}
+
+void CompactGraphTest::test_reorder()
+{
+    // The orderings are permutations, and the relabelled snapshots compute the same results
+    for(VertexOrder order : {VertexOrder::Degree, VertexOrder::BreadthFirst, VertexOrder::ReverseCuthillMcKee}){
+        std::vector<uint32_t> ordering = snapshot.getVertexOrdering(order);
+        std::vector<uint32_t> sorted = ordering;
+        std::sort(sorted.begin(), sorted.end());
+        for(uint32_t id = 0; id < sorted.size(); id++){
+            QCOMPARE(sorted[id], id);
+        }
+
+        CompactGraph<int> reordered = snapshot.reorder(order);
+        QCOMPARE(reordered.getNbArcs(), snapshot.getNbArcs());
+        int reorderedWeight = 0;
+        for(uint32_t e : reordered.getMinimumSpanningTree()){
+            reorderedWeight += reordered.getEdgeWeight(e);
+        }
+        int snapshotWeight = 0;
+        for(uint32_t e : snapshot.getMinimumSpanningTree()){
+            snapshotWeight += snapshot.getEdgeWeight(e);
+        }
+        QCOMPARE(reorderedWeight, snapshotWeight);
+        std::vector<int> reorderedDistances, snapshotDistances;
+        reordered.getMinimumDistanceTree(reordered.getVertexId(vertices[0]), &reorderedDistances);
+        snapshot.getMinimumDistanceTree(snapshot.getVertexId(vertices[0]), &snapshotDistances);
+        for(int i = 0; i < nbVertices; i++){
+            QCOMPARE(reorderedDistances[reordered.getVertexId(vertices[i])], snapshotDistances[snapshot.getVertexId(vertices[i])]);
+        }
+        for(uint32_t e = 0; e < reordered.getNbArcs(); e++){
+            QCOMPARE(reordered.getVertex(reordered.getEdgeTarget(e)), reordered.getEdge(e)->getTarget());
+            QCOMPARE(reordered.getEdgeWeight(e), reordered.getEdge(e)->getWeight());
+        }
+    }
+
+    // Reverse Cuthill-McKee brings the bandwidth of a path back to 1, whatever the order of its vertices
+    Graph<int, void, Undirected> path;
+    std::vector<int*> pathVertices;
+    for(int i = 0; i < 50; i++){
+        pathVertices.push_back(new int(i));
+    }
+    path.addVertices(pathVertices);
+    for(int i = 0; i + 1 < 50; i++){
+        path.addEdge(pathVertices[(i * 7) % 50], pathVertices[((i + 1) * 7) % 50]);
+    }
+    CompactGraph<int, void> pathSnapshot = path.freeze().reorder(VertexOrder::ReverseCuthillMcKee);
+    for(uint32_t id = 0; id < pathSnapshot.getNbVertices(); id++){
+        for(uint32_t e = pathSnapshot.getFirstEdge(id); e < pathSnapshot.getLastEdge(id); e++){
+            uint32_t target = pathSnapshot.getEdgeTarget(e);
+            QCOMPARE(target > id ? target - id : id - target, 1u);
+        }
+    }
+}
+
+void CompactGraphTest::test_breadthFirstSearch()
+{
+    // A sparse random directed graph, large enough for the search to switch to bottom-up steps and back
+    Graph<int, void> random;
+    std::vector<int*> randomVertices;
+    int nbRandomVertices = 5000;
+    for(int i = 0; i < nbRandomVertices; i++){
+        randomVertices.push_back(new int(i));
+    }
+    random.addVertices(randomVertices);
+    uint32_t seed = 12345;
+    for(int i = 0; i < 4 * nbRandomVertices; i++){
+        seed = seed * 1103515245 + 12345;
+        int source = (seed >> 8) % nbRandomVertices;
+        seed = seed * 1103515245 + 12345;
+        int target = (seed >> 8) % nbRandomVertices;
+        if(source != target && random.findEdge(randomVertices[source], randomVertices[target]) == nullptr){
+            random.addEdge(randomVertices[source], randomVertices[target]);
+        }
+    }
+    CompactGraph<int, void> randomSnapshot = random.freeze();
+    std::vector<int> expected;
+    randomSnapshot.getMinimumDistanceTree(0, &expected);
+
+    ThreadPool pool(4);
+    for(ThreadPool* searchPool : {(ThreadPool*)nullptr, &pool}){
+        BreadthFirstSearch<void> search(randomSnapshot, searchPool);
+        BreadthFirstTree tree = search.run(0);
+        uint32_t nbReached = 0;
+        for(uint32_t id = 0; id < randomSnapshot.getNbVertices(); id++){
+            if(expected[id] == CompactGraph<int, void>::UNREACHABLE){
+                QCOMPARE(tree.levels[id], BreadthFirstTree::UNREACHABLE);
+                QCOMPARE(tree.parents[id], BreadthFirstTree::NO_VERTEX);
+                continue;
+            }
+            nbReached++;
+            QCOMPARE((int)tree.levels[id], expected[id]);
+            if(id != 0){
+                // The parent is one level up and has an edge to the vertex
+                uint32_t parent = tree.parents[id];
+                QCOMPARE(tree.levels[parent] + 1, tree.levels[id]);
+                bool linked = false;
+                for(uint32_t e = randomSnapshot.getFirstEdge(parent); e < randomSnapshot.getLastEdge(parent); e++){
+                    linked = linked || randomSnapshot.getEdgeTarget(e) == id;
+                }
+                QVERIFY(linked);
+            }
+        }
+        QCOMPARE(tree.parents[0], BreadthFirstTree::NO_VERTEX);
+        QCOMPARE(tree.nbReached, nbReached);
+    }
+
+    // Every edge of K10 has a reverse edge, so the snapshot can be searched through its outgoing edges only
+    BreadthFirstSearch<int> symmetricSearch(snapshot, &pool, true);
+    BreadthFirstTree tree = symmetricSearch.run(2);
+    QCOMPARE(tree.nbReached, snapshot.getNbVertices());
+    QCOMPARE(tree.levels[2], 0u);
+    QCOMPARE(tree.levels[5], 1u);
+}
+
+void CompactGraphTest::test_heldKarp()
+{
+    // Checks that the edge ids follow each other and go through every vertex once
+    auto visitsAll = [](const CsrView<void>& view, const std::vector<uint32_t>& edgeIds, bool circuit){
+        std::vector<bool> visited(view.getNbVertices(), false);
+        uint32_t start = view.getEdgeSource(edgeIds.front());
+        visited[start] = true;
+        for(size_t i = 0; i < edgeIds.size(); i++){
+            uint32_t target = view.getEdgeTarget(edgeIds[i]);
+            if(i + 1 < edgeIds.size() && view.getEdgeSource(edgeIds[i + 1]) != target){
+                return false;
+            }
+            if(circuit && i + 1 == edgeIds.size()){
+                return target == start;
+            }
+            if(visited[target]){
+                return false;
+            }
+            visited[target] = true;
+        }
+        return true;
+    };
+
+    // The Petersen graph has a hamiltonian path but no hamiltonian circuit
+    Graph<int, void, Undirected> petersen;
+    std::vector<int*> petersenVertices;
+    for(int i = 0; i < 10; i++){
+        petersenVertices.push_back(new int(i));
+    }
+    petersen.addVertices(petersenVertices);
+    for(int i = 0; i < 5; i++){
+        petersen.addEdge(petersenVertices[i], petersenVertices[(i + 1) % 5]);
+        petersen.addEdge(petersenVertices[i], petersenVertices[i + 5]);
+        petersen.addEdge(petersenVertices[i + 5], petersenVertices[(i + 2) % 5 + 5]);
+    }
+    CompactGraph<int, void> petersenSnapshot = petersen.freeze();
+    HeldKarp<void> petersenSearch(petersenSnapshot, nullptr, true);
+    QVERIFY(petersenSearch.findCircuit().empty());
+    std::vector<uint32_t> path = petersenSearch.findPath();
+    QCOMPARE((int)path.size(), 9);
+    QVERIFY(visitsAll(petersenSnapshot, path, false));
+    QVERIFY(!petersen.isHamiltonian());
+    QCOMPARE((int)petersen.getHamiltonianPathEdges(false).size(), 9);
+
+    // A sparse random directed graph around a hidden circuit, large enough for the subsets to be split between threads
+    Graph<int, void> random;
+    std::vector<int*> randomVertices;
+    int nbRandomVertices = 24;
+    for(int i = 0; i < nbRandomVertices; i++){
+        randomVertices.push_back(new int(i));
+    }
+    random.addVertices(randomVertices);
+    std::vector<int> order;
+    for(int i = 0; i < nbRandomVertices; i++){
+        order.push_back((i * 7) % nbRandomVertices);
+    }
+    for(int i = 0; i < nbRandomVertices; i++){
+        random.addEdge(randomVertices[order[i]], randomVertices[order[(i + 1) % nbRandomVertices]]);
+    }
+    uint32_t seed = 2026;
+    for(int i = 0; i < 2 * nbRandomVertices; i++){
+        seed = seed * 1103515245 + 12345;
+        int source = (seed >> 8) % nbRandomVertices;
+        seed = seed * 1103515245 + 12345;
+        int target = (seed >> 8) % nbRandomVertices;
+        if(source != target && random.findEdge(randomVertices[source], randomVertices[target]) == nullptr){
+            random.addEdge(randomVertices[source], randomVertices[target]);
+        }
+    }
+    CompactGraph<int, void> randomSnapshot = random.freeze();
+    ThreadPool pool(4);
+    std::vector<uint32_t> circuits[2];
+    int i = 0;
+    for(ThreadPool* searchPool : {(ThreadPool*)nullptr, &pool}){
+        HeldKarp<void> search(randomSnapshot, searchPool);
+        circuits[i] = search.findCircuit();
+        QCOMPARE((int)circuits[i].size(), nbRandomVertices);
+        QCOMPARE(randomSnapshot.getEdgeSource(circuits[i].front()), 0u);
+        QVERIFY(visitsAll(randomSnapshot, circuits[i], true));
+        i++;
+    }
+    // The subsets computed in parallel are the same, so is the circuit followed back from them
+    QVERIFY(circuits[0] == circuits[1]);
+    QVERIFY(random.isHamiltonian());
+
+    // A vertex without any incoming edge rules out any circuit, but may start a path
+    Graph<int, void> star;
+    std::vector<int*> starVertices;
+    for(int i = 0; i < 3; i++){
+        starVertices.push_back(new int(i));
+    }
+    star.addVertices(starVertices);
+    star.addEdge(starVertices[0], starVertices[1]);
+    star.addEdge(starVertices[1], starVertices[2]);
+    star.addEdge(starVertices[2], starVertices[1]);
+    QVERIFY(!star.isHamiltonian());
+    std::vector<Edge<int, void>*> starPath = star.getHamiltonianPathEdges(false);
+    QCOMPARE((int)starPath.size(), 2);
+    QCOMPARE(starPath[0]->getSource(), starVertices[0]);
+    QCOMPARE(starPath[1]->getTarget(), starVertices[2]);
+}
+
+void CompactGraphTest::test_hamiltonianSearch()
+{
+    // Checks that the edges follow each other and go through every vertex once
+    auto visitsAll = [](const CsrView<void>& view, const std::vector<uint32_t>& edgeIds, bool circuit){
+        std::vector<bool> visited(view.getNbVertices(), false);
+        uint32_t start = view.getEdgeSource(edgeIds.front());
+        visited[start] = true;
+        for(size_t i = 0; i < edgeIds.size(); i++){
+            uint32_t target = view.getEdgeTarget(edgeIds[i]);
+            if(i + 1 < edgeIds.size() && view.getEdgeSource(edgeIds[i + 1]) != target){
+                return false;
+            }
+            if(circuit && i + 1 == edgeIds.size()){
+                return target == start;
+            }
+            if(visited[target]){
+                return false;
+            }
+            visited[target] = true;
+        }
+        return true;
+    };
+
+    // A sparse graph around a hidden circuit, too large for the dynamic programming
+    Graph<int, void, Undirected> sparse;
+    std::vector<int*> sparseVertices;
+    int nbSparseVertices = 300;
+    for(int i = 0; i < nbSparseVertices; i++){
+        sparseVertices.push_back(new int(i));
+    }
+    sparse.addVertices(sparseVertices);
+    for(int i = 0; i < nbSparseVertices; i++){
+        sparse.addEdge(sparseVertices[(i * 7) % nbSparseVertices], sparseVertices[((i + 1) * 7) % nbSparseVertices]);
+    }
+    uint32_t seed = 42;
+    for(int i = 0; i < nbSparseVertices / 2; i++){
+        seed = seed * 1103515245 + 12345;
+        int source = (seed >> 8) % nbSparseVertices;
+        seed = seed * 1103515245 + 12345;
+        int target = (seed >> 8) % nbSparseVertices;
+        if(source != target && sparse.findEdge(sparseVertices[source], sparseVertices[target]) == nullptr &&
+           sparse.findEdge(sparseVertices[target], sparseVertices[source]) == nullptr){
+            sparse.addEdge(sparseVertices[source], sparseVertices[target]);
+        }
+    }
+    CompactGraph<int, void> sparseSnapshot = sparse.freeze();
+    HamiltonianSearch<void> sparseSearch(sparseSnapshot, true);
+    HamiltonianSearchResult circuit = sparseSearch.findCircuit();
+    QVERIFY(circuit.status == HamiltonianStatus::Found);
+    QCOMPARE((int)circuit.edgeIds.size(), nbSparseVertices);
+    QCOMPARE(sparseSnapshot.getEdgeSource(circuit.edgeIds.front()), 0u);
+    QVERIFY(visitsAll(sparseSnapshot, circuit.edgeIds, true));
+    HamiltonianSearchResult path = sparseSearch.findPath();
+    QVERIFY(path.status == HamiltonianStatus::Found);
+    QCOMPARE((int)path.edgeIds.size(), nbSparseVertices - 1);
+    QVERIFY(visitsAll(sparseSnapshot, path.edgeIds, false));
+    QVERIFY(sparse.isHamiltonian());
+
+    // Without the edges of a vertex but one, there is still a path ending there, but no circuit
+    std::vector<Edge<int, void>*> incident;
+    sparse.forEachNeighbour(sparse.getVertexId(sparseVertices[5]), [&](uint32_t, Edge<int, void>* edge){
+        incident.push_back(edge);
+    });
+    for(size_t i = 1; i < incident.size(); i++){
+        sparse.removeEdge(incident[i]);
+    }
+    HamiltonianStatus status;
+    QVERIFY(sparse.getHamiltonianPathEdges(true, std::chrono::milliseconds::zero(), nullptr, &status).empty());
+    QVERIFY(status == HamiltonianStatus::None);
+    QVERIFY(sparse.getHamiltonianStatus(std::chrono::seconds(10)) == HamiltonianStatus::None);
+    std::vector<Edge<int, void>*> pathEdges = sparse.getHamiltonianPathEdges(false, std::chrono::milliseconds::zero(), nullptr, &status);
+    QVERIFY(status == HamiltonianStatus::Found);
+    QCOMPARE((int)pathEdges.size(), nbSparseVertices - 1);
+
+    // The directed snapshot of K10 is searched arc by arc and agrees with the dynamic programming
+    HamiltonianSearch<int> arcSearch(snapshot);
+    HamiltonianSearchResult arcCircuit = arcSearch.findCircuit();
+    QVERIFY(arcCircuit.status == HamiltonianStatus::Found);
+    QCOMPARE((int)arcCircuit.edgeIds.size(), nbVertices);
+    QCOMPARE(HeldKarp<int>(snapshot).findCircuit().size(), arcCircuit.edgeIds.size());
+
+    // Two circuits linked by a single edge have no hamiltonian circuit, which takes the search long to prove :
+    // it gives up when cancelled or out of time
+    Graph<int, void, Undirected> linked;
+    std::vector<int*> linkedVertices;
+    int half = 500;
+    for(int i = 0; i < 2 * half; i++){
+        linkedVertices.push_back(new int(i));
+    }
+    linked.addVertices(linkedVertices);
+    for(int i = 0; i < half; i++){
+        linked.addEdge(linkedVertices[i], linkedVertices[(i + 1) % half]);
+        linked.addEdge(linkedVertices[half + i], linkedVertices[half + (i + 1) % half]);
+    }
+    for(int i = 0; i < half / 2; i++){
+        seed = seed * 1103515245 + 12345;
+        int source = (seed >> 8) % half;
+        seed = seed * 1103515245 + 12345;
+        int target = (seed >> 8) % half;
+        if(source != target && linked.findEdge(linkedVertices[source], linkedVertices[target]) == nullptr &&
+           linked.findEdge(linkedVertices[target], linkedVertices[source]) == nullptr){
+            linked.addEdge(linkedVertices[source], linkedVertices[target]);
+            linked.addEdge(linkedVertices[half + source], linkedVertices[half + target]);
+        }
+    }
+    linked.addEdge(linkedVertices[0], linkedVertices[half]);
+    CompactGraph<int, void> linkedSnapshot = linked.freeze();
+    HamiltonianSearch<void> linkedSearch(linkedSnapshot, true);
+    std::atomic<bool> cancelled(true);
+    QVERIFY(linkedSearch.findCircuit(std::chrono::milliseconds::zero(), &cancelled).status == HamiltonianStatus::Interrupted);
+    QVERIFY(linkedSearch.findCircuit(std::chrono::milliseconds(1)).status == HamiltonianStatus::Interrupted);
+    QVERIFY(linked.getHamiltonianPathEdges(true, std::chrono::milliseconds(1), nullptr, &status).empty());
+    QVERIFY(status == HamiltonianStatus::Interrupted);
+    QVERIFY(linked.getHamiltonianStatus(std::chrono::milliseconds(1)) == HamiltonianStatus::Interrupted);
+    QVERIFY(linked.getHamiltonianStatus(std::chrono::milliseconds::zero(), &cancelled) == HamiltonianStatus::Interrupted);
+}
+
+QTEST_APPLESS_MAIN(CompactGraphTest)
+
+#include "tst_compactgraphtest.moc"
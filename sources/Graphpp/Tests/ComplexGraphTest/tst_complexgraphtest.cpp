@@ -14,13 +14,20 @@ public:
 
 private:
     Graph<int>* graph;
-    int* vertices;
+    std::vector<int*> vertices;
     int nbVertices = 10;
 
 
 private slots:
     void test_vertices();
     void test_edges();
+    void test_bulkLoading();
+    void test_bulkRemoval();
+    void test_cloneAndMove();
+    void test_edgePool();
+    void test_heapEdgeAllocator();
+    void test_adjacencyList();
+    void test_snapshot();
     void test_weight();
     void test_indegrees();
     void test_outdegrees();
@@ -36,22 +43,20 @@ private slots:
 ComplexGraphTest::ComplexGraphTest()
 {
     graph = new Graph<int>();
-    vertices = new int[nbVertices];
     for(int i = 0; i < nbVertices; i++){
-        vertices[i] = i+1;
+        vertices.push_back(new int(i+1));
     }
 }
 
 ComplexGraphTest::~ComplexGraphTest()
 {
-    delete vertices;
     delete graph;
 }
 void ComplexGraphTest::test_vertices()
 {
     QCOMPARE(graph->getNbVertices(), 0);
     for(int i = 0; i < nbVertices; i++){
-        graph->addVertex(&vertices[i]);
+        graph->addVertex(vertices[i]);
         QCOMPARE(graph->getNbVertices(), i+1);
     }
 }
@@ -62,13 +67,330 @@ void ComplexGraphTest::test_edges()
     for(int i = 0; i < nbVertices;i++){
         for(int j = 0; j < nbVertices; j++){
             if(i != j){
-                graph->addEdge(&vertices[i], &vertices[j], vertices[i]*vertices[j]);
+                graph->addEdge(vertices[i], vertices[j], *vertices[i] * *vertices[j]);
             }
         }
     }
     QCOMPARE(graph->getNbEdges(), ((nbVertices-1)*nbVertices)/2);
 }
 
+void ComplexGraphTest::test_bulkLoading()
+{
+    // Loading the same edges in one batch, each one twice with another weight, must give the same graph
+    Graph<int> bulkGraph;
+    std::vector<int*> bulkVertices;
+    for(int i = 0; i < nbVertices; i++){
+        bulkVertices.push_back(new int(*vertices[i]));
+    }
+    bulkGraph.addVertices(bulkVertices);
+    QCOMPARE(bulkGraph.getNbVertices(), nbVertices);
+
+    std::vector<std::tuple<int*, int*, int>> edges;
+    for(int pass = 0; pass < 2; pass++){
+        for(int i = 0; i < nbVertices; i++){
+            for(int j = 0; j < nbVertices; j++){
+                if(i != j){
+                    edges.push_back(std::make_tuple(bulkVertices[i], bulkVertices[j], (pass + 1) * *vertices[i] * *vertices[j]));
+                }
+            }
+        }
+    }
+    int unknownVertex = 0;
+    edges.push_back(std::make_tuple(bulkVertices[0], &unknownVertex, 1));
+    bulkGraph.addEdges(edges);
+
+    QCOMPARE(bulkGraph.getNbEdges(), graph->getNbEdges());
+    for(int i = 0; i < nbVertices; i++){
+        QCOMPARE(bulkGraph.getVertexOutdegree(bulkVertices[i]), graph->getVertexOutdegree(vertices[i]));
+        for(int j = 0; j < nbVertices; j++){
+            if(i != j){
+                Edge<int>* edge = bulkGraph.findEdge(bulkVertices[i], bulkVertices[j]);
+                QVERIFY(edge != nullptr);
+                QCOMPARE(edge->getWeight(), graph->findEdge(vertices[i], vertices[j])->getWeight());
+            }
+        }
+    }
+}
+
+void ComplexGraphTest::test_bulkRemoval()
+{
+    Graph<int> bulkGraph;
+    std::vector<int*> bulkVertices;
+    std::vector<std::pair<int*, int*>> edges;
+    for(int i = 0; i < nbVertices; i++){
+        bulkVertices.push_back(new int(*vertices[i]));
+    }
+    for(int i = 0; i < nbVertices; i++){
+        for(int j = 0; j < nbVertices; j++){
+            if(i != j){
+                edges.push_back(std::make_pair(bulkVertices[i], bulkVertices[j]));
+            }
+        }
+    }
+    bulkGraph.addVertices(bulkVertices);
+    bulkGraph.addEdges(edges);
+
+    // Remove the outgoing edges of the first vertex, some of them twice
+    std::vector<Edge<int>*> removedEdges(bulkGraph.adjacencyList[bulkVertices[0]].begin(), bulkGraph.adjacencyList[bulkVertices[0]].end());
+    removedEdges.push_back(removedEdges.front());
+    bulkGraph.removeEdges(removedEdges);
+    QCOMPARE(bulkGraph.getVertexOutdegree(bulkVertices[0]), 0);
+    QCOMPARE(bulkGraph.getNbEdges(), nbVertices * (nbVertices - 1) - (nbVertices - 1));
+    for(int i = 1; i < nbVertices; i++){
+        QVERIFY(bulkGraph.findEdge(bulkVertices[0], bulkVertices[i]) == nullptr);
+        QVERIFY(bulkGraph.findEdge(bulkVertices[i], bulkVertices[0])->getTwin() == nullptr);
+    }
+
+    // Remove the first two vertices, which leaves the complete graph K8
+    std::vector<int*> removedVertices = {bulkVertices[0], bulkVertices[1], bulkVertices[1]};
+    bulkGraph.removeVertices(removedVertices);
+    QCOMPARE(bulkGraph.getNbVertices(), nbVertices - 2);
+    QCOMPARE(bulkGraph.getNbEdges(), ((nbVertices - 3) * (nbVertices - 2)) / 2);
+    for(int i = 2; i < nbVertices; i++){
+        QCOMPARE(bulkGraph.getVertexIndegree(bulkVertices[i]), nbVertices - 3);
+        QCOMPARE(bulkGraph.getVertexOutdegree(bulkVertices[i]), nbVertices - 3);
+    }
+
+    // A prebuilt edge keeps its first source, so it may sit in the list of another vertex
+    Edge<int> shared(bulkVertices[4]);
+    bulkGraph.addPrebuiltEdge(bulkVertices[2], &shared);
+    bulkGraph.popEdge(&shared);
+    bulkGraph.addPrebuiltEdge(bulkVertices[3], &shared);
+    QVERIFY(shared.getSource() == bulkVertices[2]);
+    std::vector<Edge<int>*> sharedEdges = {&shared};
+    std::list<Edge<int>*> poppedEdges = bulkGraph.popEdges(sharedEdges);
+    QCOMPARE(poppedEdges.size(), 1u);
+    QVERIFY(poppedEdges.front() == &shared);
+    QCOMPARE(bulkGraph.getVertexOutdegree(bulkVertices[3]), nbVertices - 3);
+    QCOMPARE(bulkGraph.getNbEdges(), ((nbVertices - 3) * (nbVertices - 2)) / 2);
+}
+
+void ComplexGraphTest::test_cloneAndMove()
+{
+    // A clone owns copies of the vertices and edges, with the same weights
+    Graph<int> clone = graph->clone();
+    QCOMPARE(clone.getNbVertices(), nbVertices);
+    QCOMPARE(clone.getNbEdges(), graph->getNbEdges());
+    for (auto const &vertexPair : clone.adjacencyList)
+    {
+        QVERIFY(graph->adjacencyList.find(vertexPair.first) == graph->adjacencyList.end());
+        for (Edge<int>* edge : vertexPair.second)
+        {
+            QCOMPARE(edge->getWeight(), *vertexPair.first * *edge->getTarget());
+            QCOMPARE(edge->getTwin()->getTarget(), vertexPair.first);
+        }
+    }
+
+    // Moving hands the same vertices and edges over, and leaves an empty graph
+    int* vertex = clone.adjacencyList.begin()->first;
+    Edge<int>* edge = clone.adjacencyList.begin()->second.front();
+    Graph<int> moved(std::move(clone));
+    QVERIFY(clone.isEmpty());
+    QCOMPARE(clone.getNbEdges(), 0);
+    QCOMPARE(moved.getNbEdges(), graph->getNbEdges());
+    QCOMPARE(moved.findEdge(vertex, edge->getTarget()), edge);
+
+    clone = std::move(moved);
+    QVERIFY(moved.isEmpty());
+    QCOMPARE(clone.getVertexOutdegree(vertex), nbVertices - 1);
+}
+
+void ComplexGraphTest::test_edgePool()
+{
+    int target = 0;
+    EdgePool<Edge<int>> pool(1);
+
+    // A destroyed edge leaves a slot which the next created edge reuses
+    Edge<int>* first = pool.create(&target, 1);
+    Edge<int>* second = pool.create(&target, 2);
+    pool.destroy(first);
+    QCOMPARE(pool.getNbEdges(), size_t(1));
+    Edge<int>* reused = pool.create(&target, 3);
+    QCOMPARE(reused, first);
+    QCOMPARE(reused->getWeight(), 3);
+    QCOMPARE(second->getWeight(), 2);
+
+    // Edges never move while the slabs grow, and each of them is found in its slab
+    std::vector<Edge<int>*> edges = {reused, second};
+    for(int i = 0; i < 1000; i++){
+        edges.push_back(pool.create(&target, i));
+    }
+    // Reserving more than the maximum slab size allocates a single slab, usually away from the smaller ones,
+    // so that the slabs are no longer allocated by increasing address
+    size_t capacity = pool.getCapacity();
+    pool.reserve(200000);
+    QVERIFY(pool.getCapacity() >= capacity + 200000);
+    capacity = pool.getCapacity();
+    for(int i = 0; i < 200000; i++){
+        edges.push_back(pool.create(&target, i));
+    }
+    QCOMPARE(pool.getCapacity(), capacity);
+    for(int i = 0; i < 1000; i++){
+        edges.push_back(pool.create(&target, i));
+    }
+    QCOMPARE(reused->getWeight(), 3);
+    QCOMPARE(second->getWeight(), 2);
+    for(size_t i = 2; i < 1002; i++){
+        QCOMPARE(edges[i]->getWeight(), int(i - 2));
+    }
+    for(Edge<int>* edge : edges){
+        QVERIFY(pool.owns(edge));
+    }
+    Edge<int> outside(&target);
+    QVERIFY(!pool.owns(&outside));
+    QCOMPARE(pool.getNbEdges(), edges.size());
+
+    // Moving into a pool releases its own slabs and hands the edges over without moving them
+    capacity = pool.getCapacity();
+    EdgePool<Edge<int>> other(1);
+    Edge<int>* released = other.create(&target, 4);
+    QVERIFY(other.owns(released));
+    other = std::move(pool);
+    QVERIFY(!other.owns(released));
+    QCOMPARE(other.getNbEdges(), edges.size());
+    QCOMPARE(other.getCapacity(), capacity);
+    QVERIFY(other.owns(second));
+    QCOMPARE(second->getWeight(), 2);
+    QCOMPARE(pool.getNbEdges(), size_t(0));
+    QCOMPARE(pool.getCapacity(), size_t(0));
+    QVERIFY(!pool.owns(second));
+}
+
+void ComplexGraphTest::test_heapEdgeAllocator()
+{
+    int target = 0;
+    HeapEdgeAllocator<Edge<int>> allocator;
+
+    Edge<int>* first = allocator.create(&target, 1);
+    Edge<int>* second = allocator.create(&target, 2);
+    allocator.destroy(first);
+    QCOMPARE(allocator.getNbEdges(), size_t(1));
+    QVERIFY(!allocator.owns(first));
+    QVERIFY(allocator.owns(second));
+    Edge<int> outside(&target);
+    QVERIFY(!allocator.owns(&outside));
+
+    // Moving into an allocator deletes its own edges and hands the edges over
+    HeapEdgeAllocator<Edge<int>> other;
+    Edge<int>* released = other.create(&target, 4);
+    other = std::move(allocator);
+    QVERIFY(!other.owns(released));
+    QVERIFY(other.owns(second));
+    QCOMPARE(second->getWeight(), 2);
+    QCOMPARE(other.getNbEdges(), size_t(1));
+    QCOMPARE(allocator.getNbEdges(), size_t(0));
+}
+
+void ComplexGraphTest::test_adjacencyList()
+{
+    int target = 0;
+    std::vector<Edge<int>> edges(8, Edge<int>(&target));
+
+    // The first 4 edges are stored inline, the fifth one moves them all to the heap
+    AdjacencyList<Edge<int>> small;
+    for(int i = 0; i < 4; i++){
+        small.push_back(&edges[i]);
+    }
+    QCOMPARE(small.capacity(), 4u);
+    QCOMPARE(small.memoryUsage(), size_t(0));
+    AdjacencyList<Edge<int>> large = small;
+    large.push_back(&edges[4]);
+    QVERIFY(large.capacity() > 4u);
+    QVERIFY(large.memoryUsage() > 0);
+    QCOMPARE(large.size(), 5u);
+    for(int i = 0; i < 5; i++){
+        QCOMPARE(large[i], &edges[i]);
+    }
+
+    // Copies are independent, whether inline or on the heap
+    AdjacencyList<Edge<int>> smallCopy(small);
+    AdjacencyList<Edge<int>> largeCopy(large);
+    small.clear();
+    large.clear();
+    QCOMPARE(smallCopy.size(), 4u);
+    QCOMPARE(largeCopy.size(), 5u);
+    QCOMPARE(smallCopy.back(), &edges[3]);
+    QCOMPARE(largeCopy.back(), &edges[4]);
+    QVERIFY(largeCopy.memoryUsage() > 0);
+
+    // Moving an inline list copies its edges, moving a heap list takes its storage, both leave an empty list
+    const Edge<int>* const* heapStorage = largeCopy.begin();
+    AdjacencyList<Edge<int>> smallMoved(std::move(smallCopy));
+    AdjacencyList<Edge<int>> largeMoved(std::move(largeCopy));
+    QVERIFY(smallCopy.empty());
+    QVERIFY(largeCopy.empty());
+    QCOMPARE(smallCopy.memoryUsage(), size_t(0));
+    QCOMPARE(largeCopy.memoryUsage(), size_t(0));
+    QCOMPARE(smallMoved.size(), 4u);
+    QCOMPARE(largeMoved.size(), 5u);
+    QVERIFY(largeMoved.begin() == heapStorage);
+    small = std::move(largeMoved);
+    QVERIFY(small.begin() == heapStorage);
+    QCOMPARE(small.size(), 5u);
+    large = std::move(smallMoved);
+    QCOMPARE(large.size(), 4u);
+    QCOMPARE(large.memoryUsage(), size_t(0));
+
+    // Erasing moves the last edge into the erased position, which erase() returns
+    AdjacencyList<Edge<int>> list;
+    for(int i = 0; i < 6; i++){
+        list.push_back(&edges[i]);
+    }
+    Edge<int>** it = list.erase(list.begin());
+    QVERIFY(it == list.begin());
+    QCOMPARE(*it, &edges[5]);
+    it = list.erase(list.begin() + 2);
+    QCOMPARE(*it, &edges[4]);
+    it = list.erase(list.end() - 1);
+    QVERIFY(it == list.end());
+    QCOMPARE(list.size(), 3u);
+    QCOMPARE(list[0], &edges[5]);
+    QCOMPARE(list[1], &edges[1]);
+    QCOMPARE(list[2], &edges[4]);
+
+    // As the swapped-in edge takes the erased position, `it = list.erase(it)` visits it next instead of skipping it
+    for(int i = 0; i < 8; i++){
+        list.push_back(&edges[i % 2]);
+    }
+    for(Edge<int>** next = list.begin(); next != list.end();){
+        if(*next == &edges[1]){
+            next = list.erase(next);
+        } else {
+            ++next;
+        }
+    }
+    QCOMPARE(list.size(), 6u);
+    for(Edge<int>* edge : list){
+        QVERIFY(edge != &edges[1]);
+    }
+}
+
+void ComplexGraphTest::test_snapshot()
+{
+    Graph<int> live = graph->clone();
+    std::shared_ptr<Graph<int>> snapshot = live.snapshot();
+    QCOMPARE(snapshot->getNbVertices(), nbVertices);
+    QCOMPARE(snapshot->getNbEdges(), graph->getNbEdges());
+
+    // Modifying the graph leaves the snapshot untouched, and the removed vertices alive while it may refer to them
+    int* removedVertex = live.adjacencyList.begin()->first;
+    int removedValue = *removedVertex;
+    live.removeVertex(removedVertex);
+    live.addVertex(new int(0));
+    QCOMPARE(live.getNbVertices(), nbVertices);
+    QCOMPARE(live.getNbEdges(), graph->getNbEdges() - (nbVertices - 1));
+    QCOMPARE(snapshot->getNbEdges(), graph->getNbEdges());
+    QVERIFY(snapshot->adjacencyList.find(removedVertex) != snapshot->adjacencyList.end());
+    QCOMPARE(*removedVertex, removedValue);
+    QVERIFY(snapshot->isConnected());
+    QCOMPARE(snapshot->getChromaticNumber(), nbVertices);
+
+    // Once the snapshot is released, removing a vertex deletes it right away, leaving nothing for the memory checkers
+    snapshot.reset();
+    live.removeVertex(live.adjacencyList.begin()->first);
+    QCOMPARE(live.getNbVertices(), nbVertices - 1);
+}
+
 void ComplexGraphTest::test_weight()
 {
     QVERIFY(graph->isWeighted());
@@ -78,12 +400,12 @@ void ComplexGraphTest::test_weight()
 void ComplexGraphTest::test_indegrees()
 {
     for(int i = 0; i < nbVertices; i++){
-        QCOMPARE(graph->getVertexIndegree(&vertices[i]), 9);
+        QCOMPARE(graph->getVertexIndegree(vertices[i]), 9);
     }
 }
 void ComplexGraphTest::test_outdegrees(){
     for(int i = 0; i < nbVertices; i++){
-        QCOMPARE(graph->getVertexOutdegree(&vertices[i]), 9);
+        QCOMPARE(graph->getVertexOutdegree(vertices[i]), 9);
     }
 }
 
@@ -104,7 +426,10 @@ void ComplexGraphTest::test_orientation()
 
 void ComplexGraphTest::test_eulerian()
 {
+    // The vertices have an odd degree, 9
     QVERIFY(!graph->isEulerian());
+    QVERIFY(graph->getEulerianKind() == EulerianKind::None);
+    QVERIFY(graph->getEulerianPath().empty());
 }
 void ComplexGraphTest::test_chromaticNumber()
 {
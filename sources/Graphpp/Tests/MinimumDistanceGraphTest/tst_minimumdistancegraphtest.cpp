@@ -23,7 +23,7 @@ private:
     Graph<int>* initial;
     Graph<int>* expected;
     Graph<int>* actual;
-    int* vertices;
+    std::vector<int*> vertices;
     int nbVertices = 10;
 
 private slots:
@@ -32,30 +32,29 @@ private slots:
     void test_vertices();
     void test_edges();
     void test_graph_weight();
+    void test_shortestPaths();
 
 };
 
 MinimumDistanceGraphTest::MinimumDistanceGraphTest()
 {
     initial = new Graph<int>();
-    expected = new Graph<int>();
-    vertices = new int[nbVertices];
+    std::vector<Edge<int>*> expectedEdges;
     for(int i = 0; i < nbVertices; i++){
-        vertices[i] = i+1;
-        initial->addVertex(&vertices[i]);
-        expected->addVertex(&vertices[i]);
+        vertices.push_back(new int(i+1));
+        initial->addVertex(vertices[i]);
     }
     for(int i = 0; i < nbVertices;i++){
         for(int j = 0; j < nbVertices; j++){
             if(i != j){
-                initial->addEdge(&vertices[i], &vertices[j], vertices[i]*vertices[j]);
+                initial->addEdge(vertices[i], vertices[j], *vertices[i] * *vertices[j]);
                 if(i == 0 || j == 0){
                     auto hasTarget = [this, j](Edge<int> edge){
-                        return &vertices[j] == edge.getTarget();
+                        return vertices[j] == edge.getTarget();
                     };
-                    Edge<int>* edge = std::find_if(initial->adjacencyList[&vertices[i]].front(), initial->adjacencyList[&vertices[i]].back(), hasTarget);
+                    Edge<int>* edge = std::find_if(initial->adjacencyList[vertices[i]].front(), initial->adjacencyList[vertices[i]].back(), hasTarget);
                     if(edge != nullptr){
-                        expected->addPrebuiltEdge(&vertices[i], edge);
+                        expectedEdges.push_back(edge);
                     }
 
                 }
@@ -63,15 +62,15 @@ MinimumDistanceGraphTest::MinimumDistanceGraphTest()
         }
     }
 
-    actual = initial->getMinimumDistanceGraph(&vertices[0]);
+    expected = initial->getSubgraph(expectedEdges);
+    actual = initial->getMinimumDistanceGraph(vertices[0]);
 }
 
 MinimumDistanceGraphTest::~MinimumDistanceGraphTest()
 {
-    delete vertices;
-    delete initial;
-    delete expected;
     delete actual;
+    delete expected;
+    delete initial;
 }
 
 void MinimumDistanceGraphTest::test_vertices_nb()
@@ -124,6 +123,28 @@ void MinimumDistanceGraphTest::test_edges(){
     }
 }
 
+void MinimumDistanceGraphTest::test_shortestPaths(){
+    // Every shortest path from the '1' vertex is its direct edge to the target
+    ShortestPaths<int> paths = initial->getShortestPaths(vertices[0]);
+    uint32_t startId = initial->getVertexId(vertices[0]);
+    QCOMPARE(paths.startingVertexId, startId);
+    QCOMPARE(paths.getDistance(startId), 0);
+    QVERIFY(paths.getPath(startId).empty());
+    for(int i = 1; i < nbVertices; i++){
+        uint32_t id = initial->getVertexId(vertices[i]);
+        QVERIFY(paths.isReachable(id));
+        QCOMPARE(paths.getDistance(id), *vertices[i]);
+        QCOMPARE(paths.predecessors[id], startId);
+        std::vector<Edge<int>*> path = paths.getPath(id);
+        QCOMPARE(path.size(), size_t(1));
+        QCOMPARE(path.front(), initial->findEdge(vertices[0], vertices[i]));
+    }
+    QCOMPARE(paths.getTreeEdges().size(), size_t(nbVertices - 1));
+
+    int unknownVertex = 0;
+    QCOMPARE(initial->getShortestPaths(&unknownVertex).startingVertexId, ShortestPaths<int>::NO_VERTEX);
+}
+
 QTEST_APPLESS_MAIN(MinimumDistanceGraphTest)
 
 #include "tst_minimumdistancegraphtest.moc"
@@ -21,7 +21,7 @@ private:
     Graph<int>* initial;
     Graph<int>* expected;
     Graph<int>* actual;
-    int* vertices;
+    std::vector<int*> vertices;
     int nbVertices = 10;
 
 private slots:
@@ -36,24 +36,22 @@ private slots:
 MinimumSpanningTreeTest::MinimumSpanningTreeTest()
 {
     initial = new Graph<int>();
-    expected = new Graph<int>();
-    vertices = new int[nbVertices];
+    std::vector<Edge<int>*> expectedEdges;
     for(int i = 0; i < nbVertices; i++){
-        vertices[i] = i+1;
-        initial->addVertex(&vertices[i]);
-        expected->addVertex(&vertices[i]);
+        vertices.push_back(new int(i+1));
+        initial->addVertex(vertices[i]);
     }
     for(int i = 0; i < nbVertices;i++){
         for(int j = 0; j < nbVertices; j++){
             if(i != j){
-                initial->addEdge(&vertices[i], &vertices[j], vertices[i]*vertices[j]);
+                initial->addEdge(vertices[i], vertices[j], *vertices[i] * *vertices[j]);
                 if(i == 0 || j == 0){
                     auto hasTarget = [this, j](Edge<int> edge){
-                        return &vertices[j] == edge.getTarget();
+                        return vertices[j] == edge.getTarget();
                     };
-                    Edge<int>* edge = std::find_if(initial->adjacencyList[&vertices[i]].front(), initial->adjacencyList[&vertices[i]].back(), hasTarget);
+                    Edge<int>* edge = std::find_if(initial->adjacencyList[vertices[i]].front(), initial->adjacencyList[vertices[i]].back(), hasTarget);
                     if(edge != nullptr){
-                        expected->addPrebuiltEdge(&vertices[i], edge);
+                        expectedEdges.push_back(edge);
                     }
 
                 }
@@ -61,15 +59,15 @@ MinimumSpanningTreeTest::MinimumSpanningTreeTest()
         }
     }
 
+    expected = initial->getSubgraph(expectedEdges);
     actual = initial->getMinimumSpanningTree();
 }
 
 MinimumSpanningTreeTest::~MinimumSpanningTreeTest()
 {
-    delete vertices;
-    delete initial;
-    delete expected;
     delete actual;
+    delete expected;
+    delete initial;
 }
 
 void MinimumSpanningTreeTest::test_vertices_nb()
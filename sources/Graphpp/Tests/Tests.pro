@@ -2,6 +2,7 @@ TEMPLATE = subdirs
 
 SUBDIRS += \
     BasicGraphTest \
+    CompactGraphTest \
     ComplexGraphTest \
     MinimumDistanceGraphTest \
     MinimumSpanningTreeTest